@@ -184,6 +184,22 @@ std::vector<std::pair<int, int>> AIPathfinder::findPathDijkstra(
     return std::vector<std::pair<int, int>>();
 }
 
+/**
+ * Begin a resumable BFS search
+ */
+PathSearch AIPathfinder::beginSearchBFS(int startX, int startY, int endX, int endY,
+                                        const MazeGenerator& maze) {
+    return PathSearch(PathSearch::Algorithm::BFS, startX, startY, endX, endY, maze);
+}
+
+/**
+ * Begin a resumable Dijkstra search
+ */
+PathSearch AIPathfinder::beginSearchDijkstra(int startX, int startY, int endX, int endY,
+                                             const MazeGenerator& maze) {
+    return PathSearch(PathSearch::Algorithm::Dijkstra, startX, startY, endX, endY, maze);
+}
+
 /**
  * Get path length
  */
@@ -6,6 +6,7 @@
 #include <unordered_map>
 #include <algorithm>
 #include "MazeGenerator.h"
+#include "PathSearch.h"
 
 /**
  * AIPathfinder class
@@ -58,6 +59,13 @@ public:
         int endX, int endY, 
         const MazeGenerator& maze);
     
+    // Begin a resumable search that advances in bounded slices
+    // Call step()/stepFor() on the returned object until it finishes
+    PathSearch beginSearchBFS(int startX, int startY, int endX, int endY,
+                              const MazeGenerator& maze);
+    PathSearch beginSearchDijkstra(int startX, int startY, int endX, int endY,
+                                   const MazeGenerator& maze);
+    
     // Get path length
     int getPathLength(const std::vector<std::pair<int, int>>& path);
 };
@@ -0,0 +1,223 @@
+#include "AgentBatch.h"
+#include <algorithm>
+
+/**
+ * Constructor: Place every agent on the start cell
+ */
+AgentBatch::AgentBatch(const MazeGenerator& maze, size_t count, int startX, int startY)
+    : grid(maze.getPassabilityGrid()), stride(maze.getPassabilityStride()),
+      generation(0), pending(0), stopping(false) {
+
+    std::pair<int, int> exitPos = maze.getExitPosition();
+    exitIndex = maze.getPassabilityIndex(exitPos.first, exitPos.second);
+
+    delta[0] = -stride;
+    delta[1] = stride;
+    delta[2] = -1;
+    delta[3] = 1;
+
+    cell.assign(count, maze.getPassabilityIndex(startX, startY));
+    moveCount.assign(count, 0);
+    atGoal.assign(count, 0);
+}
+
+/**
+ * Destructor: Wake the workers and wait for them to exit
+ */
+AgentBatch::~AgentBatch() {
+    {
+        std::lock_guard<std::mutex> lock(poolMutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+/**
+ * Branch-free update of a block of agents
+ * Walls and finished agents turn into "stay" via masks instead of branches
+ */
+void AgentBatch::stepRange(size_t begin, size_t end, const uint8_t* directions) {
+    int32_t* cells = cell.data();
+    int32_t* counts = moveCount.data();
+    uint8_t* goal = atGoal.data();
+    const unsigned char* open = grid;
+    const int32_t target = exitIndex;
+    const int32_t d0 = delta[0], d1 = delta[1], d2 = delta[2], d3 = delta[3];
+
+    for (size_t i = begin; i < end; i++) {
+        uint8_t dir = directions[i] & 3;
+        int32_t offset = dir == 0 ? d0 : dir == 1 ? d1 : dir == 2 ? d2 : d3;
+        int32_t current = cells[i];
+        int32_t next = current + offset;
+        int32_t canMove = open[next] & (goal[i] ^ 1);
+
+        cells[i] = canMove ? next : current;
+        counts[i] += canMove;
+        goal[i] |= (uint8_t)(cells[i] == target);
+    }
+}
+
+/**
+ * Random-walk update of a block of agents
+ * Direction is a cheap integer hash of (agent index, seed)
+ */
+void AgentBatch::stepRandomRange(size_t begin, size_t end, uint32_t seed) {
+    int32_t* cells = cell.data();
+    int32_t* counts = moveCount.data();
+    uint8_t* goal = atGoal.data();
+    const unsigned char* open = grid;
+    const int32_t target = exitIndex;
+    const int32_t d0 = delta[0], d1 = delta[1], d2 = delta[2], d3 = delta[3];
+
+    for (size_t i = begin; i < end; i++) {
+        uint32_t h = (uint32_t)i * 0x9E3779B1u ^ seed;
+        h ^= h >> 15;
+        h *= 0x2C1B3C6Du;
+        h ^= h >> 12;
+        uint32_t dir = h >> 30;
+
+        int32_t offset = dir == 0 ? d0 : dir == 1 ? d1 : dir == 2 ? d2 : d3;
+        int32_t current = cells[i];
+        int32_t next = current + offset;
+        int32_t canMove = open[next] & (goal[i] ^ 1);
+
+        cells[i] = canMove ? next : current;
+        counts[i] += canMove;
+        goal[i] |= (uint8_t)(cells[i] == target);
+    }
+}
+
+/**
+ * Worker thread: run this worker's block of every new job
+ * Workers beyond the current job's block count sit the job out
+ */
+void AgentBatch::workerLoop(size_t index) {
+    uint64_t seen = 0;
+    std::unique_lock<std::mutex> lock(poolMutex);
+    while (true) {
+        wake.wait(lock, [&]() { return stopping || generation != seen; });
+        if (stopping) return;
+        seen = generation;
+        if (index >= blocks.size()) continue;
+
+        std::pair<size_t, size_t> range = blocks[index];
+        lock.unlock();
+        job(range.first, range.second);
+        lock.lock();
+        if (--pending == 0) {
+            finished.notify_one();
+        }
+    }
+}
+
+/**
+ * Split the agents into contiguous blocks, one per thread
+ * Block boundaries are rounded to 64 agents so threads never share a cache line;
+ * the block size is rounded up from count / threads, so the blocks always
+ * cover every agent (the last one may be shorter)
+ */
+void AgentBatch::forEachBlock(int threadCount, const BlockJob& fn) {
+    size_t count = cell.size();
+    const size_t MIN_BLOCK = 4096;
+
+    if (threadCount <= 1 || count < MIN_BLOCK * 2) {
+        fn((size_t)0, count);
+        return;
+    }
+
+    size_t threads = std::min((size_t)threadCount, count / MIN_BLOCK);
+    size_t block = (((count + threads - 1) / threads) + 63) & ~(size_t)63;
+
+    std::unique_lock<std::mutex> lock(poolMutex);
+    blocks.clear();
+    for (size_t begin = 0; begin < count; begin += block) {
+        blocks.emplace_back(begin, std::min(count, begin + block));
+    }
+
+    // Start missing workers once; they stay alive for later steps
+    while (workers.size() + 1 < blocks.size()) {
+        size_t index = workers.size() + 1;
+        workers.emplace_back(&AgentBatch::workerLoop, this, index);
+    }
+
+    job = fn;
+    pending = blocks.size() - 1;
+    generation++;
+    std::pair<size_t, size_t> first = blocks[0];
+    lock.unlock();
+    wake.notify_all();
+
+    // Calling thread takes the first block
+    fn(first.first, first.second);
+
+    lock.lock();
+    finished.wait(lock, [this]() { return pending == 0; });
+    job = nullptr;
+}
+
+/**
+ * Move every agent one step
+ */
+void AgentBatch::step(const uint8_t* directions, int threadCount) {
+    forEachBlock(threadCount, [this, directions](size_t begin, size_t end) {
+        stepRange(begin, end, directions);
+    });
+}
+
+/**
+ * Random-walk step for every agent
+ */
+void AgentBatch::stepRandom(uint32_t seed, int threadCount) {
+    forEachBlock(threadCount, [this, seed](size_t begin, size_t end) {
+        stepRandomRange(begin, end, seed);
+    });
+}
+
+/**
+ * Get number of agents
+ */
+size_t AgentBatch::size() const {
+    return cell.size();
+}
+
+/**
+ * Get agent X position
+ */
+int AgentBatch::getX(size_t agent) const {
+    return cell[agent] % stride - 1;
+}
+
+/**
+ * Get agent Y position
+ */
+int AgentBatch::getY(size_t agent) const {
+    return cell[agent] / stride - 1;
+}
+
+/**
+ * Get agent move count
+ */
+int AgentBatch::getMoves(size_t agent) const {
+    return moveCount[agent];
+}
+
+/**
+ * Check if agent reached the exit
+ */
+bool AgentBatch::hasReachedGoal(size_t agent) const {
+    return atGoal[agent] != 0;
+}
+
+/**
+ * Count agents at the exit
+ */
+size_t AgentBatch::countReachedGoal() const {
+    size_t total = 0;
+    for (uint8_t flag : atGoal) {
+        total += flag;
+    }
+    return total;
+}
@@ -0,0 +1,85 @@
+#ifndef AGENT_BATCH_H
+#define AGENT_BATCH_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include "MazeGenerator.h"
+
+/**
+ * AgentBatch class
+ * Structure-of-arrays simulation of many maze walkers at once
+ * Positions, move counts and goal flags are parallel arrays, and a step
+ * updates every agent in one branch-free loop against the maze's padded
+ * passability bitmap, so the compiler can vectorize it. Large populations
+ * can be split across threads (each thread owns a contiguous block); the
+ * worker threads are started once and reused for every step
+ * Member: 2 - Player control
+ */
+class AgentBatch {
+private:
+    const unsigned char* grid;   // Padded passability bitmap
+    int stride;
+    int exitIndex;
+    int32_t delta[4];            // Index offsets: up, down, left, right
+
+    // Parallel per-agent arrays
+    std::vector<int32_t> cell;       // Bitmap index of each agent
+    std::vector<int32_t> moveCount;  // Successful moves
+    std::vector<uint8_t> atGoal;     // 1 once the agent reached the exit
+
+    // Update agents [begin, end) with explicit or hashed directions
+    void stepRange(size_t begin, size_t end, const uint8_t* directions);
+    void stepRandomRange(size_t begin, size_t end, uint32_t seed);
+
+    // Persistent worker pool: worker i runs blocks[i] of each job
+    using BlockJob = std::function<void(size_t, size_t)>;
+    std::vector<std::thread> workers;
+    std::mutex poolMutex;
+    std::condition_variable wake;
+    std::condition_variable finished;
+    BlockJob job;
+    std::vector<std::pair<size_t, size_t>> blocks;
+    uint64_t generation;
+    size_t pending;
+    bool stopping;
+
+    void workerLoop(size_t index);
+
+    // Run fn(begin, end) over threadCount contiguous blocks
+    void forEachBlock(int threadCount, const BlockJob& fn);
+
+public:
+    // Constructor: count agents, all at (startX, startY)
+    AgentBatch(const MazeGenerator& maze, size_t count, int startX, int startY);
+
+    // Destructor: stops the worker threads
+    ~AgentBatch();
+
+    AgentBatch(const AgentBatch&) = delete;
+    AgentBatch& operator=(const AgentBatch&) = delete;
+
+    // Move every agent one step; directions[i] is a MoveHistory code (0-3)
+    // Agents that reached the exit stay there
+    void step(const uint8_t* directions, int threadCount = 1);
+
+    // Random-walk step: direction derived from (agent, seed), so results
+    // don't depend on how agents are split across threads
+    void stepRandom(uint32_t seed, int threadCount = 1);
+
+    // Get agent state
+    size_t size() const;
+    int getX(size_t agent) const;
+    int getY(size_t agent) const;
+    int getMoves(size_t agent) const;
+    bool hasReachedGoal(size_t agent) const;
+
+    // Number of agents at the exit
+    size_t countReachedGoal() const;
+};
+
+#endif // AGENT_BATCH_H
@@ -0,0 +1,90 @@
+#include "AnimationScheduler.h"
+#include <algorithm>
+#include <thread>
+
+/**
+ * Constructor: Pick the frame period and steps per frame
+ */
+AnimationScheduler::AnimationScheduler(long long totalSteps, int maxDurationMs,
+                                       int fastestFrameMs, int slowestFrameMs)
+    : totalSteps(std::max(0LL, totalSteps)), nextStep(0), stepsPerFrame(1),
+      frameIndex(0), lateFrames(0), started(false) {
+    long long steps = std::max(1LL, this->totalSteps);
+    long long budget = std::max(1, maxDurationMs);
+
+    // Slow enough to follow for short runs, never faster than the terminal can show
+    long long periodMs = std::max<long long>(fastestFrameMs,
+                                             std::min<long long>(slowestFrameMs, budget / steps));
+    periodMs = std::max(1LL, periodMs);
+
+    // Batch steps once one step per frame would overrun the budget
+    long long frames = std::max(1LL, budget / periodMs);
+    stepsPerFrame = (steps + frames - 1) / frames;
+
+    period = std::chrono::milliseconds(periodMs);
+}
+
+/**
+ * Get the steps shown in the next frame
+ */
+bool AnimationScheduler::nextFrame(long long& first, long long& last) {
+    if (nextStep >= totalSteps) {
+        return false;
+    }
+    first = nextStep;
+    last = std::min(totalSteps, nextStep + stepsPerFrame);
+    nextStep = last;
+    return true;
+}
+
+/**
+ * Sleep until the next frame's deadline
+ */
+void AnimationScheduler::waitForFrame() {
+    Clock::time_point now = Clock::now();
+    if (!started) {
+        // Frame 0 is due right away
+        start = now;
+        started = true;
+        return;
+    }
+
+    frameIndex++;
+    Clock::time_point deadline = start + period * frameIndex;
+
+    if (now > deadline + period) {
+        // More than a frame behind: restart the grid from here
+        lateFrames++;
+        start = now - period * frameIndex;
+        return;
+    }
+    std::this_thread::sleep_until(deadline);
+}
+
+/**
+ * Get steps shown per frame
+ */
+long long AnimationScheduler::getStepsPerFrame() const {
+    return stepsPerFrame;
+}
+
+/**
+ * Get frame period in milliseconds
+ */
+int AnimationScheduler::getFramePeriodMs() const {
+    return (int)std::chrono::duration_cast<std::chrono::milliseconds>(period).count();
+}
+
+/**
+ * Get number of frames waited for so far
+ */
+long long AnimationScheduler::getFrameCount() const {
+    return frameIndex;
+}
+
+/**
+ * Get number of times the schedule was re-anchored
+ */
+long long AnimationScheduler::getLateFrames() const {
+    return lateFrames;
+}
@@ -0,0 +1,47 @@
+#ifndef ANIMATION_SCHEDULER_H
+#define ANIMATION_SCHEDULER_H
+
+#include <chrono>
+
+/**
+ * AnimationScheduler class
+ * Paces a step-by-step animation at a fixed frame rate
+ * Frame k is due at start + k * period (absolute deadlines, so time spent
+ * drawing or oversleeping never accumulates into drift). Long animations
+ * show several steps per frame so the whole run fits in the time budget:
+ * the period shrinks from slowestFrameMs toward fastestFrameMs first, then
+ * steps are batched. If drawing falls more than a frame behind, the
+ * schedule is re-anchored instead of rushing to catch up
+ * Member: 6 - Utility + Display
+ */
+class AnimationScheduler {
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    long long totalSteps;
+    long long nextStep;
+    long long stepsPerFrame;
+    Clock::duration period;
+    Clock::time_point start;
+    long long frameIndex;
+    long long lateFrames;
+    bool started;
+
+public:
+    // Constructor: plan totalSteps to take at most maxDurationMs
+    AnimationScheduler(long long totalSteps, int maxDurationMs,
+                       int fastestFrameMs, int slowestFrameMs);
+
+    // Steps [first, last) to show in the next frame; false when all shown
+    bool nextFrame(long long& first, long long& last);
+
+    // Sleep until the next frame is due (first call starts the clock)
+    void waitForFrame();
+
+    long long getStepsPerFrame() const;
+    int getFramePeriodMs() const;
+    long long getFrameCount() const;
+    long long getLateFrames() const;
+};
+
+#endif // ANIMATION_SCHEDULER_H
@@ -0,0 +1,339 @@
+#include "Benchmark.h"
+#include "Telemetry.h"
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <algorithm>
+#include <numeric>
+#include <cmath>
+#include <cstdlib>
+#include <cerrno>
+
+namespace {
+
+/**
+ * Parse a whole argument as a number within [minValue, maxValue]
+ */
+bool parseNumber(const char* text, double minValue, double maxValue, double& value) {
+    if (text == nullptr || *text == '\0') {
+        return false;
+    }
+    char* end = nullptr;
+    errno = 0;
+    double parsed = std::strtod(text, &end);
+    if (errno != 0 || *end != '\0' || !(parsed >= minValue && parsed <= maxValue)) {
+        return false;
+    }
+    value = parsed;
+    return true;
+}
+
+} // namespace
+
+/**
+ * Constructor
+ */
+Benchmark::Benchmark(const Options& options) : options(options) {}
+
+/**
+ * Register a benchmark case
+ */
+void Benchmark::add(const std::string& name, const std::string& sizeMeaning,
+                    int opsPerSample, double growth, Setup setup) {
+    cases.push_back(Case{ name, sizeMeaning, std::max(1, opsPerSample), growth, std::move(setup) });
+}
+
+/**
+ * Measure every case at every size
+ */
+void Benchmark::run(std::ostream& table) {
+    table << std::left << std::setw(32) << "benchmark" << std::right
+          << std::setw(7) << "size" << std::setw(8) << "samples"
+          << std::setw(11) << "min" << std::setw(11) << "mean" << std::setw(11) << "p50"
+          << std::setw(11) << "p90" << std::setw(11) << "p99" << std::setw(11) << "max" << std::endl;
+
+    for (const Case& benchCase : cases) {
+        if (!options.filter.empty() && benchCase.name.find(options.filter) == std::string::npos) {
+            continue;
+        }
+
+        double previousSeconds = 0;     // One full sample at the previous size
+        int previousSize = 0;
+        for (int size : options.sizes) {
+            // Skip sizes predicted to take too long for even one sample
+            double predicted = 0;
+            if (previousSize > 0) {
+                predicted = previousSeconds * std::pow((double)size / previousSize, benchCase.growth);
+                if (predicted > options.caseLimitSeconds) {
+                    Result skipped;
+                    skipped.name = benchCase.name;
+                    skipped.size = size;
+                    skipped.opsPerSample = benchCase.opsPerSample;
+                    skipped.skipped = true;
+                    skipped.predictedSeconds = predicted;
+                    writeRow(table, skipped);
+                    results.push_back(skipped);
+                    continue;
+                }
+            }
+
+            Result result = measure(benchCase, size, predicted);
+            writeRow(table, result);
+            previousSeconds = (double)result.samples.front() * result.opsPerSample / 1e9;
+            previousSize = size;
+            results.push_back(std::move(result));
+        }
+    }
+}
+
+/**
+ * Prepare, warm up and sample one case at one size
+ */
+Benchmark::Result Benchmark::measure(const Case& benchCase, int size, double predictedSeconds) {
+    Result result;
+    result.name = benchCase.name;
+    result.size = size;
+    result.opsPerSample = benchCase.opsPerSample;
+
+    Sample sample = benchCase.setup(size);
+
+    // Warm-up: caches, allocator and page tables; cut short for slow cases
+    // and skipped when one run is expected to exceed the whole budget
+    int64_t budgetNs = (int64_t)(options.budgetSeconds * 1e9);
+    int warmupRuns = (predictedSeconds > options.budgetSeconds) ? 0 : options.warmupRuns;
+    int64_t warmupStart = Telemetry::now();
+    for (int i = 0; i < warmupRuns && Telemetry::now() - warmupStart < budgetNs / 2; i++) {
+        sample();
+        result.warmupRuns++;
+    }
+
+    int64_t slowNs = (int64_t)(options.slowSeconds * 1e9);
+    int64_t elapsed = 0;
+    while ((int)result.samples.size() < options.maxSamples) {
+        int64_t start = Telemetry::now();
+        sample();
+        int64_t duration = Telemetry::now() - start;
+        elapsed += duration;
+        result.samples.push_back(duration / benchCase.opsPerSample);
+
+        bool enough = (int)result.samples.size() >= options.minSamples || elapsed >= slowNs;
+        if (elapsed >= budgetNs && enough) {
+            break;
+        }
+    }
+
+    std::sort(result.samples.begin(), result.samples.end());
+    return result;
+}
+
+/**
+ * Value at a percentile of sorted samples (nearest rank)
+ */
+int64_t Benchmark::percentile(const std::vector<int64_t>& sorted, double percent) {
+    if (sorted.empty()) {
+        return 0;
+    }
+    size_t rank = (size_t)std::ceil(percent / 100.0 * sorted.size());
+    return sorted[std::min(sorted.size(), std::max<size_t>(rank, 1)) - 1];
+}
+
+/**
+ * Short human-readable duration
+ */
+std::string Benchmark::formatNs(double nanoseconds) {
+    std::ostringstream text;
+    text << std::fixed << std::setprecision(nanoseconds < 10 ? 1 : 0);
+    if (nanoseconds < 1e4) {
+        text << nanoseconds << "ns";
+    } else if (nanoseconds < 1e7) {
+        text << std::setprecision(1) << nanoseconds / 1e3 << "us";
+    } else if (nanoseconds < 1e10) {
+        text << std::setprecision(1) << nanoseconds / 1e6 << "ms";
+    } else {
+        text << std::setprecision(2) << nanoseconds / 1e9 << "s";
+    }
+    return text.str();
+}
+
+/**
+ * One table row
+ */
+void Benchmark::writeRow(std::ostream& out, const Result& result) const {
+    out << std::left << std::setw(32) << result.name << std::right << std::setw(7) << result.size;
+    if (result.skipped) {
+        out << "  skipped (one sample predicted at " << std::fixed << std::setprecision(0)
+            << result.predictedSeconds << "s)" << std::endl;
+        return;
+    }
+
+    const std::vector<int64_t>& samples = result.samples;
+    double mean = std::accumulate(samples.begin(), samples.end(), 0.0) / samples.size();
+    out << std::setw(8) << samples.size()
+        << std::setw(11) << formatNs((double)samples.front())
+        << std::setw(11) << formatNs(mean)
+        << std::setw(11) << formatNs((double)percentile(samples, 50))
+        << std::setw(11) << formatNs((double)percentile(samples, 90))
+        << std::setw(11) << formatNs((double)percentile(samples, 99))
+        << std::setw(11) << formatNs((double)samples.back()) << std::endl;
+}
+
+/**
+ * Whole run as JSON: configuration, then one object per case and size
+ */
+void Benchmark::writeJson(std::ostream& out) const {
+    out << "{\n  \"config\": {\"warmup_runs\": " << options.warmupRuns
+        << ", \"min_samples\": " << options.minSamples
+        << ", \"max_samples\": " << options.maxSamples
+        << ", \"budget_seconds\": " << options.budgetSeconds
+        << ", \"case_limit_seconds\": " << options.caseLimitSeconds
+#ifdef __OPTIMIZE__
+        << ", \"optimized\": true"
+#else
+        << ", \"optimized\": false"
+#endif
+        << "},\n  \"results\": [";
+
+    for (size_t i = 0; i < results.size(); i++) {
+        const Result& result = results[i];
+        const std::string* meaning = nullptr;
+        for (const Case& benchCase : cases) {
+            if (benchCase.name == result.name) {
+                meaning = &benchCase.sizeMeaning;
+            }
+        }
+
+        out << (i == 0 ? "\n" : ",\n") << "    {\"name\": \"" << result.name << "\""
+            << ", \"size\": " << result.size
+            << ", \"size_meaning\": \"" << (meaning ? *meaning : "") << "\""
+            << ", \"ops_per_sample\": " << result.opsPerSample;
+        if (result.skipped) {
+            out << ", \"skipped\": true, \"predicted_seconds\": "
+                << std::fixed << std::setprecision(1) << result.predictedSeconds << "}";
+            continue;
+        }
+
+        const std::vector<int64_t>& samples = result.samples;
+        double mean = std::accumulate(samples.begin(), samples.end(), 0.0) / samples.size();
+        double variance = 0;
+        for (int64_t value : samples) {
+            variance += (value - mean) * (value - mean);
+        }
+        variance /= samples.size();
+
+        out << ", \"skipped\": false"
+            << ", \"warmup_runs\": " << result.warmupRuns
+            << ", \"samples\": " << samples.size()
+            << std::fixed << std::setprecision(1)
+            << ", \"min_ns\": " << samples.front()
+            << ", \"mean_ns\": " << mean
+            << ", \"stddev_ns\": " << std::sqrt(variance)
+            << ", \"p50_ns\": " << percentile(samples, 50)
+            << ", \"p90_ns\": " << percentile(samples, 90)
+            << ", \"p99_ns\": " << percentile(samples, 99)
+            << ", \"max_ns\": " << samples.back()
+            << ", \"ops_per_second\": " << (mean > 0 ? 1e9 / mean : 0.0) << "}";
+    }
+    out << "\n  ]\n}" << std::endl;
+}
+
+/**
+ * Get all results so far
+ */
+const std::vector<Benchmark::Result>& Benchmark::getResults() const {
+    return results;
+}
+
+/**
+ * Get options
+ */
+const Benchmark::Options& Benchmark::getOptions() const {
+    return options;
+}
+
+/**
+ * Parse command line options
+ */
+bool Benchmark::parse(int argc, char* argv[], Options& options, std::string& error) {
+    for (int i = 1; i < argc; i++) {
+        std::string flag = argv[i];
+        const char* value = (i + 1 < argc) ? argv[i + 1] : nullptr;
+        double number = 0;
+
+        if (flag == "--sizes") {
+            options.sizes.clear();
+            std::istringstream list(value ? value : "");
+            std::string item;
+            while (std::getline(list, item, ',')) {
+                if (!parseNumber(item.c_str(), 1, 65535, number)) {
+                    error = "--sizes needs a comma-separated list of sizes from 1 to 65535";
+                    return false;
+                }
+                options.sizes.push_back((int)number);
+            }
+            if (options.sizes.empty()) {
+                error = "--sizes needs at least one size";
+                return false;
+            }
+        } else if (flag == "--max-size") {
+            if (!parseNumber(value, 1, 65535, number)) {
+                error = "--max-size needs a size from 1 to 65535";
+                return false;
+            }
+            options.sizes.erase(std::remove_if(options.sizes.begin(), options.sizes.end(),
+                                               [number](int size) { return size > number; }),
+                                options.sizes.end());
+        } else if (flag == "--filter") {
+            if (value == nullptr) {
+                error = "--filter needs part of a benchmark name";
+                return false;
+            }
+            options.filter = value;
+        } else if (flag == "--warmup") {
+            if (!parseNumber(value, 0, 1000, number)) {
+                error = "--warmup needs a number of runs from 0 to 1000";
+                return false;
+            }
+            options.warmupRuns = (int)number;
+        } else if (flag == "--min-samples" || flag == "--max-samples") {
+            if (!parseNumber(value, 1, 1e7, number)) {
+                error = flag + " needs a number of samples";
+                return false;
+            }
+            (flag == "--min-samples" ? options.minSamples : options.maxSamples) = (int)number;
+        } else if (flag == "--budget") {
+            if (!parseNumber(value, 0, 3600, number)) {
+                error = "--budget needs seconds per case and size";
+                return false;
+            }
+            options.budgetSeconds = number;
+        } else if (flag == "--case-limit") {
+            if (!parseNumber(value, 0, 86400, number)) {
+                error = "--case-limit needs seconds";
+                return false;
+            }
+            options.caseLimitSeconds = number;
+        } else if (flag == "--output") {
+            if (value == nullptr) {
+                error = "--output needs a file name (- for stdout)";
+                return false;
+            }
+            options.outputPath = value;
+        } else {
+            error = "unknown option " + flag;
+            return false;
+        }
+        i++;
+    }
+
+    options.maxSamples = std::max(options.maxSamples, options.minSamples);
+    return true;
+}
+
+/**
+ * Print usage
+ */
+void Benchmark::printUsage(std::ostream& out, const char* program) {
+    out << "Usage: " << program << " [--sizes 15,63,...] [--max-size N] [--filter NAME]" << std::endl
+        << "       [--warmup RUNS] [--min-samples N] [--max-samples N] [--budget SECONDS]" << std::endl
+        << "       [--case-limit SECONDS] [--output results.json|-]" << std::endl;
+}
@@ -0,0 +1,92 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <string>
+#include <vector>
+#include <functional>
+#include <cstdint>
+#include <ostream>
+
+/**
+ * Benchmark class
+ * Micro-benchmark runner: each case is measured at a series of sizes with
+ * warm-up runs, then repeated until a time budget and a minimum number of
+ * samples are reached. Results are reported as min / mean / p50 / p90 /
+ * p99 / max per operation (exact percentiles over the samples) in a table
+ * and as a JSON document, so runs can be compared across commits
+ * A size is skipped when the previous size's timing, scaled by the growth
+ * in cells, predicts a single run longer than the per-case limit
+ * Member: 5 - Game management
+ */
+class Benchmark {
+public:
+    struct Options {
+        std::vector<int> sizes = { 15, 63, 255, 1023, 4095, 16383 };
+        std::string filter;             // Only cases whose name contains this
+        int warmupRuns = 2;
+        int minSamples = 5;
+        int maxSamples = 1000;
+        double budgetSeconds = 1.0;     // Measured time per case and size
+        double slowSeconds = 10.0;      // Fewer than minSamples is fine past this
+        double caseLimitSeconds = 60.0; // Predicted single run above this is skipped
+        std::string outputPath;         // JSON file ("-" = stdout, empty = none)
+    };
+
+    // Runs one sample (opsPerSample operations) of a prepared case
+    using Sample = std::function<void()>;
+
+    // Prepares a case for a size (called once per size, untimed)
+    using Setup = std::function<Sample(int size)>;
+
+    struct Result {
+        std::string name;
+        int size = 0;
+        int opsPerSample = 1;
+        int warmupRuns = 0;
+        std::vector<int64_t> samples;   // Nanoseconds per operation, sorted
+        bool skipped = false;
+        double predictedSeconds = 0;    // Why it was skipped
+    };
+
+private:
+    struct Case {
+        std::string name;
+        std::string sizeMeaning;
+        int opsPerSample;
+        double growth;                  // Expected time ratio exponent in size
+        Setup setup;
+    };
+
+    Options options;
+    std::vector<Case> cases;
+    std::vector<Result> results;
+
+    Result measure(const Case& benchCase, int size, double predictedSeconds);
+    void writeRow(std::ostream& out, const Result& result) const;
+
+    static int64_t percentile(const std::vector<int64_t>& sorted, double percent);
+    static std::string formatNs(double nanoseconds);
+
+public:
+    explicit Benchmark(const Options& options);
+
+    // Register a case; growth is how its time scales with size (2 = with
+    // the number of cells), used to skip sizes that would run too long
+    void add(const std::string& name, const std::string& sizeMeaning,
+             int opsPerSample, double growth, Setup setup);
+
+    // Measure every case at every size, printing a table row per result
+    void run(std::ostream& table);
+
+    // Whole run as one JSON document
+    void writeJson(std::ostream& out) const;
+
+    const std::vector<Result>& getResults() const;
+    const Options& getOptions() const;
+
+    // Parse argv; false with a message in error
+    static bool parse(int argc, char* argv[], Options& options, std::string& error);
+    static void printUsage(std::ostream& out, const char* program);
+};
+
+#endif // BENCHMARK_H
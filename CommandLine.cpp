@@ -0,0 +1,671 @@
+#include "CommandLine.h"
+#include "MazeGenerator.h"
+#include "AIPathfinder.h"
+#include "Telemetry.h"
+#include "ExternalSolver.h"
+#include "ReplayVerifier.h"
+#include "ConcurrentLeaderboard.h"
+#include "ImageExporter.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <sstream>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <random>
+#include <algorithm>
+#include <cstdlib>
+#include <cerrno>
+#include <cctype>
+
+namespace {
+
+// Largest maze side accepted (memory grows with its square)
+const long long MAX_SIZE = 65535;
+
+/**
+ * Parse a whole argument as a non-negative integer
+ */
+bool parseNumber(const char* text, long long maxValue, long long& value) {
+    if (text == nullptr || *text == '\0') {
+        return false;
+    }
+    char* end = nullptr;
+    errno = 0;
+    long long parsed = std::strtoll(text, &end, 10);
+    if (errno != 0 || *end != '\0' || parsed < 0 || parsed > maxValue) {
+        return false;
+    }
+    value = parsed;
+    return true;
+}
+
+/**
+ * Nanoseconds as milliseconds
+ */
+double toMs(int64_t nanoseconds) {
+    return nanoseconds / 1e6;
+}
+
+} // namespace
+
+/**
+ * Constructor: Options are assumed valid (see parse())
+ */
+CommandLine::CommandLine(const Options& options) : options(options) {
+    if (this->options.threads <= 0) {
+        this->options.threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    if (!this->options.seedGiven) {
+        this->options.seed = std::random_device{}();
+    }
+}
+
+/**
+ * Single-purpose commands, in usage order
+ */
+const CommandLine::Tool CommandLine::TOOLS[] = {
+    { "--solve-file", 1, "<maze.txt> [tremaux|wall] [solution.txt]", &CommandLine::solveFile },
+    { "--verify-replays", 1, "<replays.txt> [threads]", &CommandLine::verifyReplays },
+    { "--bench-leaderboard", 0, "[submissions per thread]", &CommandLine::benchLeaderboard },
+    { "--export", 2, "<image.ppm|image.png> <size|maze.txt> [pixels per cell] [nopath]", &CommandLine::exportImage },
+    { "--load-maze", 1, "<maze.txt> [copy.txt]", &CommandLine::loadMaze },
+};
+
+/**
+ * Check if a word is a headless command
+ */
+bool CommandLine::isCommand(const std::string& word) {
+    return word == "gen" || word == "solve" || word == "bench" || findTool(word) != nullptr;
+}
+
+/**
+ * Find a single-purpose command by flag
+ */
+const CommandLine::Tool* CommandLine::findTool(const std::string& flag) {
+    for (const Tool& tool : TOOLS) {
+        if (flag == tool.flag) {
+            return &tool;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * Report bad arguments, returns the exit code for them
+ */
+int CommandLine::usageError(const char* program, const std::string& message) {
+    std::cerr << "Error: " << message << std::endl;
+    printUsage(std::cerr, program);
+    return 1;
+}
+
+/**
+ * Parse command and options
+ */
+bool CommandLine::parse(int argc, char* argv[], Options& options, std::string& error) {
+    if (argc < 2 || !isCommand(argv[1])) {
+        error = "expected a command: gen, solve or bench";
+        return false;
+    }
+    options.command = argv[1];
+
+    for (int i = 2; i < argc; i++) {
+        std::string flag = argv[i];
+        const char* value = (i + 1 < argc) ? argv[i + 1] : nullptr;
+        long long number = 0;
+
+        if (flag == "--size") {
+            if (!parseNumber(value, MAX_SIZE, number) || number < 5) {
+                error = "--size needs a number from 5 to " + std::to_string(MAX_SIZE);
+                return false;
+            }
+            options.size = (int)number;
+        } else if (flag == "--count") {
+            if (!parseNumber(value, 100000000, number) || number < 1) {
+                error = "--count needs a positive number";
+                return false;
+            }
+            options.count = (int)number;
+        } else if (flag == "--algo") {
+            if (value == nullptr || (std::string(value) != "bfs" && std::string(value) != "dijkstra")) {
+                error = "--algo must be bfs or dijkstra";
+                return false;
+            }
+            options.algo = value;
+        } else if (flag == "--seed") {
+            if (!parseNumber(value, 0xFFFFFFFFLL, number)) {
+                error = "--seed needs a number from 0 to 4294967295";
+                return false;
+            }
+            options.seed = (uint32_t)number;
+            options.seedGiven = true;
+        } else if (flag == "--threads") {
+            if (!parseNumber(value, 1024, number)) {
+                error = "--threads needs a number from 0 (all cores) to 1024";
+                return false;
+            }
+            options.threads = (int)number;
+        } else if (flag == "--input") {
+            if (value == nullptr) {
+                error = "--input needs a maze file";
+                return false;
+            }
+            options.inputPath = value;
+        } else if (flag == "--output") {
+            if (value == nullptr) {
+                error = "--output needs a file name";
+                return false;
+            }
+            options.outputPath = value;
+        } else {
+            error = "unknown option " + flag;
+            return false;
+        }
+        i++;
+    }
+
+    if (!options.inputPath.empty() && options.command != "solve") {
+        error = "--input only applies to solve";
+        return false;
+    }
+    if (!options.outputPath.empty() && options.command != "gen") {
+        error = "--output only applies to gen";
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Entry point for every headless command
+ */
+int CommandLine::main(int argc, char* argv[]) {
+    const Tool* tool = (argc > 1) ? findTool(argv[1]) : nullptr;
+    if (tool) {
+        if (argc < 2 + tool->requiredArguments) {
+            return usageError(argv[0], std::string(tool->flag) + " needs " + tool->arguments);
+        }
+        return tool->run(argc, argv);
+    }
+
+    Options options;
+    std::string error;
+    if (!parse(argc, argv, options, error)) {
+        return usageError(argv[0], error);
+    }
+
+    CommandLine commandLine(options);
+    return commandLine.run(std::cout);
+}
+
+/**
+ * Print usage for the batch commands and the other headless flags
+ */
+void CommandLine::printUsage(std::ostream& out, const char* program) {
+    out << "Usage: " << program << " gen|solve|bench [--size N] [--count K] [--algo bfs|dijkstra]" << std::endl
+        << "                 [--seed S] [--threads T] [--input maze.txt] [--output maze.txt]" << std::endl
+        << "  gen    generate K mazes of N x N (--output writes them as text)" << std::endl
+        << "  solve  generate and solve K mazes (or solve --input maze.txt)" << std::endl
+        << "  bench  generate and solve K mazes, print only the summary" << std::endl
+        << "Other headless commands:" << std::endl;
+    for (const Tool& tool : TOOLS) {
+        out << "  " << program << " " << tool.flag << " " << tool.arguments << std::endl;
+    }
+}
+
+/**
+ * Run every maze across the worker threads while this thread prints them
+ * Results go into a ring of window slots; this thread takes them in maze
+ * order and workers wait before starting a maze the ring has no slot for,
+ * so output streams and memory stays bounded however many mazes there are
+ */
+int CommandLine::run(std::ostream& out) {
+    int count = options.inputPath.empty() ? options.count : 1;
+    int threadCount = std::min(options.threads, count);
+    int window = threadCount * RESULTS_PER_THREAD;
+
+    std::vector<Result> ring(window);
+    std::vector<char> ready(window, 0);
+    int printed = 0;
+    std::mutex mutex;
+    std::condition_variable resultReady;
+    std::condition_variable slotFree;
+
+    int64_t begin = Telemetry::now();
+    std::atomic<int> next(0);
+    auto worker = [&]() {
+        for (int i = next.fetch_add(1); i < count; i = next.fetch_add(1)) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                slotFree.wait(lock, [&]() { return i - printed < window; });
+            }
+            Result result;
+            runOne(i, result);
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                ring[i % window] = result;
+                ready[i % window] = 1;
+            }
+            resultReady.notify_one();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; t++) {
+        threads.emplace_back(worker);
+    }
+
+    std::ios::fmtflags flags = out.flags();
+    std::streamsize precision = out.precision();
+    out << std::fixed << std::setprecision(3);
+
+    Totals totals;
+    while (printed < count) {
+        Result result;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            if (!ready[printed % window]) {
+                // Nothing to print yet: push what's written to the reader
+                lock.unlock();
+                out.flush();
+                lock.lock();
+                resultReady.wait(lock, [&]() { return ready[printed % window] != 0; });
+            }
+            result = ring[printed % window];
+            ready[printed % window] = 0;
+            printed++;
+        }
+        slotFree.notify_all();
+
+        if (options.command != "bench") {
+            writeResult(out, result);
+        }
+        totals.add(result);
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    double seconds = toMs(Telemetry::now() - begin) / 1000.0;
+
+    writeSummary(out, totals, threadCount, seconds);
+    out.flags(flags);
+    out.precision(precision);
+
+    return totals.failures == 0 ? 0 : 2;
+}
+
+/**
+ * Add one result to the summary totals
+ */
+void CommandLine::Totals::add(const Result& result) {
+    if (count == 0) {
+        width = result.width;
+    }
+    count++;
+    generate.record((uint64_t)result.generateNs);
+    if (result.solveNs >= 0) {
+        solve.record((uint64_t)result.solveNs);
+        unsolved += (result.pathLength < 0);
+    }
+    failures += !result.ok;
+}
+
+/**
+ * Generate (or load), optionally solve, and time one maze
+ */
+void CommandLine::runOne(int index, Result& result) const {
+    result.index = index;
+    result.seed = options.seed + (uint32_t)index;
+
+    int side = options.inputPath.empty() ? options.size : 3;
+    MazeGenerator maze(side, side);
+    int64_t start = Telemetry::now();
+    if (options.inputPath.empty()) {
+        maze.generateMaze(result.seed);
+    } else {
+        result.seed = 0;
+        result.ok = maze.loadFromFile(options.inputPath);
+    }
+    result.generateNs = Telemetry::now() - start;
+    result.width = maze.getWidth();
+    result.height = maze.getHeight();
+    if (!result.ok) {
+        return;
+    }
+
+    if (options.command == "gen") {
+        if (!options.outputPath.empty()) {
+            result.ok = maze.saveToFile(outputPathFor(index));
+        }
+        return;
+    }
+
+    AIPathfinder pathfinder;
+    std::pair<int, int> from = maze.getStartPosition();
+    std::pair<int, int> to = maze.getExitPosition();
+    start = Telemetry::now();
+    std::vector<std::pair<int, int>> path = (options.algo == "dijkstra")
+        ? pathfinder.findPathDijkstra(from.first, from.second, to.first, to.second, maze)
+        : pathfinder.findPathBFS(from.first, from.second, to.first, to.second, maze);
+    result.solveNs = Telemetry::now() - start;
+    result.pathLength = path.empty() ? -1 : (int)path.size() - 1;
+}
+
+/**
+ * One JSON line for one maze
+ */
+void CommandLine::writeResult(std::ostream& out, const Result& result) const {
+    out << "{\"command\":" << jsonString(options.command)
+        << ",\"index\":" << result.index
+        << ",\"seed\":" << result.seed
+        << ",\"width\":" << result.width
+        << ",\"height\":" << result.height
+        << (options.inputPath.empty() ? ",\"generate_ms\":" : ",\"load_ms\":")
+        << toMs(result.generateNs);
+    if (result.solveNs >= 0) {
+        out << ",\"algo\":" << jsonString(options.algo)
+            << ",\"solve_ms\":" << toMs(result.solveNs)
+            << ",\"path_length\":" << result.pathLength;
+    }
+    if (!options.inputPath.empty()) {
+        out << ",\"input\":" << jsonString(options.inputPath);
+    }
+    if (!options.outputPath.empty()) {
+        out << ",\"output\":" << jsonString(outputPathFor(result.index));
+    }
+    out << ",\"ok\":" << (result.ok ? "true" : "false") << "}\n";
+}
+
+/**
+ * Summary JSON line: totals, throughput and timing percentiles
+ */
+void CommandLine::writeSummary(std::ostream& out, const Totals& totals, int threads, double seconds) const {
+    auto timings = [&out](const char* name, const Telemetry::Histogram& histogram) {
+        out << ",\"" << name << "\":{\"mean\":" << histogram.mean() / 1e6
+            << ",\"p50\":" << toMs((int64_t)histogram.percentile(50))
+            << ",\"p90\":" << toMs((int64_t)histogram.percentile(90))
+            << ",\"p99\":" << toMs((int64_t)histogram.percentile(99))
+            << ",\"max\":" << toMs((int64_t)histogram.max()) << "}";
+    };
+
+    out << "{\"summary\":" << jsonString(options.command)
+        << ",\"size\":" << totals.width
+        << ",\"count\":" << totals.count
+        << ",\"threads\":" << threads;
+    if (options.inputPath.empty()) {
+        out << ",\"seed\":" << options.seed;
+    }
+    if (options.command != "gen") {
+        out << ",\"algo\":" << jsonString(options.algo);
+    }
+    out << ",\"seconds\":" << seconds
+        << ",\"mazes_per_second\":" << (seconds > 0 ? totals.count / seconds : 0.0);
+    timings(options.inputPath.empty() ? "generate_ms" : "load_ms", totals.generate);
+    if (totals.solve.count() > 0) {
+        timings("solve_ms", totals.solve);
+        out << ",\"unsolved\":" << totals.unsolved;
+    }
+    out << ",\"failures\":" << totals.failures << "}" << std::endl;
+}
+
+/**
+ * Output file for maze index: the name as given for a single maze,
+ * otherwise with "-<index>" before the extension
+ */
+std::string CommandLine::outputPathFor(int index) const {
+    if (options.count == 1) {
+        return options.outputPath;
+    }
+    std::string path = options.outputPath;
+    size_t dot = path.find_last_of('.');
+    size_t slash = path.find_last_of("/\\");
+    if (dot == std::string::npos || (slash != std::string::npos && dot < slash)) {
+        dot = path.size();
+    }
+    return path.substr(0, dot) + "-" + std::to_string(index) + path.substr(dot);
+}
+
+/**
+ * Quote and escape text as a JSON string
+ */
+std::string CommandLine::jsonString(const std::string& text) {
+    std::ostringstream quoted;
+    quoted << '"';
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            quoted << '\\' << c;
+        } else if ((unsigned char)c < 0x20) {
+            quoted << "\\u" << std::hex << std::setw(4) << std::setfill('0') << (int)c << std::dec;
+        } else {
+            quoted << c;
+        }
+    }
+    quoted << '"';
+    return quoted.str();
+}
+
+/**
+ * --solve-file: out-of-core solve of a maze file
+ */
+int CommandLine::solveFile(int argc, char* argv[]) {
+    std::string method = (argc > 3) ? argv[3] : "tremaux";
+    if (method != "tremaux" && method != "wall") {
+        return usageError(argv[0], "--solve-file method must be tremaux or wall");
+    }
+
+    ExternalSolver solver;
+    if (!solver.open(argv[2])) {
+        std::cerr << "Could not map maze file: " << argv[2] << std::endl;
+        return 1;
+    }
+
+    ExternalSolver::Report report = solver.solve(
+        method == "wall" ? ExternalSolver::Method::WallFollower : ExternalSolver::Method::Tremaux);
+
+    std::cout << "width=" << solver.getWidth() << std::endl;
+    std::cout << "height=" << solver.getHeight() << std::endl;
+    std::cout << "method=" << method << std::endl;
+    std::cout << "solved=" << (report.solved ? 1 : 0) << std::endl;
+    std::cout << "path_length=" << report.pathLength << std::endl;
+    std::cout << "steps_walked=" << report.stepsWalked << std::endl;
+    std::cout << "pages_touched=" << report.pagesTouched << std::endl;
+    std::cout << "peak_rss_kb=" << report.peakResidentKB << std::endl;
+    std::cout << "seconds=" << report.seconds << std::endl;
+
+    if (report.solved && argc > 4 && method != "wall") {
+        if (!solver.writeSolution(argv[4])) {
+            std::cerr << "Could not write solution: " << argv[4] << std::endl;
+            return 1;
+        }
+    }
+
+    return report.solved ? 0 : 2;
+}
+
+/**
+ * --verify-replays: re-verify every replay in a file
+ */
+int CommandLine::verifyReplays(int argc, char* argv[]) {
+    long long threads = 0;
+    if (argc > 3 && !parseNumber(argv[3], 1024, threads)) {
+        return usageError(argv[0], "--verify-replays threads must be 0 (all cores) to 1024");
+    }
+    std::vector<size_t> malformed;
+    std::vector<ReplayRecord> replays = ReplayVerifier::loadFile(argv[2], &malformed);
+
+    auto begin = std::chrono::steady_clock::now();
+    std::vector<ReplayVerifier::Verdict> verdicts = ReplayVerifier::verifyBatch(replays, (int)threads);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+    // Report rejections in file order; lines that didn't parse are
+    // rejected as malformed
+    long long valid = std::count(verdicts.begin(), verdicts.end(), ReplayVerifier::Verdict::VALID);
+    size_t nextMalformed = 0;
+    for (size_t i = 0; i <= verdicts.size(); i++) {
+        size_t line = (i < verdicts.size()) ? replays[i].line : (size_t)-1;
+        while (nextMalformed < malformed.size() && malformed[nextMalformed] < line) {
+            std::cout << "rejected line=" << malformed[nextMalformed++]
+                      << " reason=malformed" << std::endl;
+        }
+        if (i < verdicts.size() && verdicts[i] != ReplayVerifier::Verdict::VALID) {
+            std::cout << "rejected line=" << line << " player=" << replays[i].playerName
+                      << " reason=" << ReplayVerifier::verdictName(verdicts[i]) << std::endl;
+        }
+    }
+
+    long long total = (long long)(replays.size() + malformed.size());
+    std::cout << "replays=" << total << std::endl;
+    std::cout << "valid=" << valid << std::endl;
+    std::cout << "rejected=" << total - valid << std::endl;
+    std::cout << "seconds=" << seconds << std::endl;
+    std::cout << "replays_per_second=" << (seconds > 0 ? replays.size() / seconds : 0) << std::endl;
+
+    return valid == total ? 0 : 2;
+}
+
+/**
+ * --bench-leaderboard: leaderboard contention benchmark
+ * Writer threads submit random scores while one reader keeps asking for
+ * the top 10; reported per writer count from 1 to 64
+ */
+int CommandLine::benchLeaderboard(int argc, char* argv[]) {
+    long long submissions = 100000;
+    if (argc > 2 && (!parseNumber(argv[2], 100000000, submissions) || submissions < 1)) {
+        return usageError(argv[0], "--bench-leaderboard needs a positive number of submissions");
+    }
+    int perThread = (int)submissions;
+
+    for (int writers = 1; writers <= 64; writers *= 2) {
+        ConcurrentLeaderboard board;
+        std::atomic<bool> done(false);
+        std::atomic<long long> reads(0);
+
+        std::thread reader([&]() {
+            while (!done.load(std::memory_order_relaxed)) {
+                board.top(10);
+                reads.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+
+        auto begin = std::chrono::steady_clock::now();
+        std::vector<std::thread> threads;
+        for (int t = 0; t < writers; t++) {
+            threads.emplace_back([&board, t, perThread]() {
+                std::mt19937 rng(1234 + t);
+                std::uniform_int_distribution<int> player(0, 999999);
+                std::uniform_int_distribution<int> points(0, 2000);
+                for (int i = 0; i < perThread; i++) {
+                    board.submit("player" + std::to_string(player(rng)), points(rng));
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        done.store(true);
+        reader.join();
+
+        long long submissions = (long long)writers * perThread;
+        std::cout << "writers=" << writers
+                  << " submissions=" << submissions
+                  << " seconds=" << seconds
+                  << " submits_per_second=" << (long long)(submissions / seconds)
+                  << " top10_reads_per_second=" << (long long)(reads.load() / seconds)
+                  << " players=" << board.size() << std::endl;
+    }
+
+    return 0;
+}
+
+/**
+ * --export: write a maze as a PPM or PNG image
+ * The source is either a size (a new maze, solved with BFS unless "nopath"
+ * is given) or a maze text file such as a --solve-file solution
+ */
+int CommandLine::exportImage(int argc, char* argv[]) {
+    std::string outputPath = argv[2];
+    std::string source = argv[3];
+    long long pixelsPerCell = 1;
+    if (argc > 4 && (!parseNumber(argv[4], MAX_SIZE, pixelsPerCell) || pixelsPerCell < 1)) {
+        return usageError(argv[0], "--export pixels per cell must be 1 to " + std::to_string(MAX_SIZE));
+    }
+    bool drawPath = !(argc > 5 && std::string(argv[5]) == "nopath");
+
+    auto begin = std::chrono::steady_clock::now();
+    long long size = 0;
+    bool numeric = !source.empty() && std::all_of(source.begin(), source.end(), ::isdigit);
+    if (numeric && !parseNumber(source.c_str(), MAX_SIZE, size)) {
+        return usageError(argv[0], "--export size must be at most " + std::to_string(MAX_SIZE));
+    }
+    bool ok;
+
+    if (numeric) {
+        if (size < 5) size = 5;
+        if (size % 2 == 0) size++;
+
+        MazeGenerator maze((int)size, (int)size);
+        maze.generateMaze();
+
+        std::vector<std::pair<int, int>> path;
+        if (drawPath) {
+            auto start = maze.getStartPosition();
+            auto exit = maze.getExitPosition();
+            AIPathfinder pathfinder;
+            path = pathfinder.findPathBFS(start.first, start.second, exit.first, exit.second, maze);
+        }
+        std::cout << "seed=" << maze.getSeed() << std::endl;
+        std::cout << "path_length=" << (path.empty() ? 0 : (int)path.size() - 1) << std::endl;
+
+        ok = ImageExporter::exportMaze(maze, path, outputPath, (int)pixelsPerCell);
+    } else {
+        ok = ImageExporter::exportMazeFile(source, outputPath, (int)pixelsPerCell);
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    if (!ok) {
+        std::cerr << "Could not export " << source << " to " << outputPath << std::endl;
+        return 1;
+    }
+    std::cout << "image=" << outputPath << std::endl;
+    std::cout << "seconds=" << seconds << std::endl;
+    return 0;
+}
+
+/**
+ * --load-maze: load (validate) a maze text file and optionally write it
+ * back out; reports geometry, endpoints and throughput
+ */
+int CommandLine::loadMaze(int argc, char* argv[]) {
+    MazeGenerator maze(3, 3);
+    auto begin = std::chrono::steady_clock::now();
+    if (!maze.loadFromFile(argv[2])) {
+        std::cerr << "Not a valid maze file: " << argv[2] << std::endl;
+        return 1;
+    }
+    double loadSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    double megabytes = (double)maze.getHeight() * (maze.getWidth() + 1) / (1024.0 * 1024.0);
+
+    std::cout << "width=" << maze.getWidth() << std::endl;
+    std::cout << "height=" << maze.getHeight() << std::endl;
+    std::cout << "start=" << maze.getStartPosition().first << "," << maze.getStartPosition().second << std::endl;
+    std::cout << "exit=" << maze.getExitPosition().first << "," << maze.getExitPosition().second << std::endl;
+    std::cout << "load_seconds=" << loadSeconds << std::endl;
+    std::cout << "load_mb_per_second=" << (loadSeconds > 0 ? megabytes / loadSeconds : 0) << std::endl;
+
+    if (argc > 3) {
+        begin = std::chrono::steady_clock::now();
+        if (!maze.saveToFile(argv[3])) {
+            std::cerr << "Could not write maze: " << argv[3] << std::endl;
+            return 1;
+        }
+        double saveSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        std::cout << "save_seconds=" << saveSeconds << std::endl;
+        std::cout << "save_mb_per_second=" << (saveSeconds > 0 ? megabytes / saveSeconds : 0) << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,114 @@
+#ifndef COMMAND_LINE_H
+#define COMMAND_LINE_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <ostream>
+#include "Telemetry.h"
+
+/**
+ * CommandLine class
+ * Headless batch mode: generate, solve and benchmark mazes from scripts
+ *   MazeRunner gen|solve|bench [--size N] [--count K] [--algo bfs|dijkstra]
+ *                              [--seed S] [--threads T] [--input maze.txt]
+ *                              [--output maze.txt]
+ * Maze i uses seed S + i, so any result can be reproduced on its own.
+ * Mazes are spread over T worker threads; every result is printed as one
+ * JSON object per line (in maze order) as soon as it and every earlier
+ * maze are done, followed by a summary line with throughput and
+ * p50/p90/p99 timings in milliseconds. Workers run at most a fixed window
+ * of mazes ahead of the output, so memory doesn't grow with K
+ * The single-purpose headless commands (--solve-file, --verify-replays,
+ * --bench-leaderboard, --export, --load-maze) are dispatched here too, so
+ * there is one entry point and one usage text
+ * Member: 5 - Game management
+ */
+class CommandLine {
+public:
+    struct Options {
+        std::string command;
+        int size = 101;
+        int count = 1;
+        std::string algo = "bfs";
+        uint32_t seed = 0;
+        bool seedGiven = false;
+        int threads = 0;            // 0 = one per hardware thread
+        std::string inputPath;      // solve: maze file instead of generated mazes
+        std::string outputPath;     // gen: write the maze text here
+    };
+
+    // Outcome of one maze
+    struct Result {
+        int index = 0;
+        uint32_t seed = 0;
+        int width = 0;
+        int height = 0;
+        int64_t generateNs = 0;     // Generation (or loading) time
+        int64_t solveNs = -1;       // -1 when not solved (gen)
+        int pathLength = -1;        // Moves, -1 if there is no path
+        bool ok = true;             // Load/save succeeded
+    };
+
+private:
+    // Running totals for the summary line (results aren't kept)
+    struct Totals {
+        Telemetry::Histogram generate;
+        Telemetry::Histogram solve;
+        long long count = 0;
+        long long failures = 0;
+        long long unsolved = 0;
+        int width = 0;              // Of the first maze
+
+        void add(const Result& result);
+    };
+
+    // Results each worker may run ahead of the printed output
+    static const int RESULTS_PER_THREAD = 64;
+
+    Options options;
+
+    void runOne(int index, Result& result) const;
+    void writeResult(std::ostream& out, const Result& result) const;
+    void writeSummary(std::ostream& out, const Totals& totals, int threads, double seconds) const;
+    std::string outputPathFor(int index) const;
+
+    static std::string jsonString(const std::string& text);
+
+    // Single-purpose command: flag, positional arguments (required first)
+    struct Tool {
+        const char* flag;
+        int requiredArguments;
+        const char* arguments;
+        int (*run)(int argc, char* argv[]);
+    };
+    static const Tool TOOLS[];
+
+    static const Tool* findTool(const std::string& flag);
+    static int usageError(const char* program, const std::string& message);
+
+    static int solveFile(int argc, char* argv[]);
+    static int verifyReplays(int argc, char* argv[]);
+    static int benchLeaderboard(int argc, char* argv[]);
+    static int exportImage(int argc, char* argv[]);
+    static int loadMaze(int argc, char* argv[]);
+
+public:
+    explicit CommandLine(const Options& options);
+
+    // Run the command, returns the process exit code
+    int run(std::ostream& out);
+
+    // True for every headless command (gen, solve, bench and the --flags)
+    static bool isCommand(const std::string& word);
+
+    // Parse argv (argv[1] is the command); false with a message in error
+    static bool parse(int argc, char* argv[], Options& options, std::string& error);
+
+    // Dispatch, parse and run, printing usage on bad arguments
+    static int main(int argc, char* argv[]);
+
+    static void printUsage(std::ostream& out, const char* program);
+};
+
+#endif // COMMAND_LINE_H
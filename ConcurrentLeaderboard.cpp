@@ -0,0 +1,176 @@
+#include "ConcurrentLeaderboard.h"
+#include <functional>
+#include <queue>
+
+namespace {
+
+/**
+ * Ordering: higher score first, ties broken by name
+ */
+bool ranksAbove(const std::pair<std::string, int>& a, const std::pair<std::string, int>& b) {
+    if (a.second != b.second) {
+        return a.second > b.second;
+    }
+    return a.first < b.first;
+}
+
+/**
+ * K-way merge of sorted lists, keeping the best count entries
+ */
+std::vector<std::pair<std::string, int>> mergeSorted(
+    const std::vector<const std::vector<std::pair<std::string, int>>*>& lists, int count) {
+
+    typedef std::pair<size_t, size_t> Cursor;   // (list, position)
+    auto worse = [&lists](const Cursor& a, const Cursor& b) {
+        return ranksAbove((*lists[b.first])[b.second], (*lists[a.first])[a.second]);
+    };
+    std::priority_queue<Cursor, std::vector<Cursor>, decltype(worse)> heap(worse);
+
+    for (size_t i = 0; i < lists.size(); i++) {
+        if (!lists[i]->empty()) {
+            heap.push(Cursor(i, 0));
+        }
+    }
+
+    std::vector<std::pair<std::string, int>> merged;
+    while (!heap.empty() && (int)merged.size() < count) {
+        Cursor best = heap.top();
+        heap.pop();
+        merged.push_back((*lists[best.first])[best.second]);
+        if (best.second + 1 < lists[best.first]->size()) {
+            heap.push(Cursor(best.first, best.second + 1));
+        }
+    }
+    return merged;
+}
+
+} // namespace
+
+/**
+ * Constructor: Empty shards with empty published tops
+ */
+ConcurrentLeaderboard::ConcurrentLeaderboard() : playerCount(0) {
+    for (Shard& shard : shards) {
+        std::atomic_store(&shard.top, std::make_shared<const std::vector<Entry>>());
+    }
+}
+
+/**
+ * Pick a shard by name hash
+ */
+ConcurrentLeaderboard::Shard& ConcurrentLeaderboard::shardFor(const std::string& playerName) {
+    return shards[std::hash<std::string>()(playerName) & (SHARD_COUNT - 1)];
+}
+
+/**
+ * Pick a shard by name hash (read-only)
+ */
+const ConcurrentLeaderboard::Shard& ConcurrentLeaderboard::shardFor(const std::string& playerName) const {
+    return shards[std::hash<std::string>()(playerName) & (SHARD_COUNT - 1)];
+}
+
+/**
+ * Record a score
+ * The shard's published top is only rebuilt when the new score makes it
+ */
+bool ConcurrentLeaderboard::submit(const std::string& playerName, int score, bool* added) {
+    Shard& shard = shardFor(playerName);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    size_t before = shard.board.size();
+    if (!shard.board.submit(playerName, score)) {
+        return false;
+    }
+    bool isNew = shard.board.size() > before;
+    if (isNew) {
+        playerCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (added) {
+        *added = isNew;
+    }
+
+    std::shared_ptr<const std::vector<Entry>> current = std::atomic_load(&shard.top);
+    bool entersTop = (int)current->size() < TOP_K ||
+                     ranksAbove(std::make_pair(playerName, score), current->back());
+    if (entersTop) {
+        std::atomic_store(&shard.top, std::make_shared<const std::vector<Entry>>(shard.board.top(TOP_K)));
+    }
+    return true;
+}
+
+/**
+ * Get a player's best score
+ */
+bool ConcurrentLeaderboard::getScore(const std::string& playerName, int& score) const {
+    const Shard& shard = shardFor(playerName);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.board.getScore(playerName, score);
+}
+
+/**
+ * Get 1-based rank of a player
+ */
+int ConcurrentLeaderboard::getRank(const std::string& playerName) const {
+    int score;
+    if (!getScore(playerName, score)) {
+        return 0;
+    }
+    return countAbove(score, playerName) + 1;
+}
+
+/**
+ * Count players ranked above a key, one shard lock at a time
+ */
+int ConcurrentLeaderboard::countAbove(int score, const std::string& playerName) const {
+    int above = 0;
+    for (const Shard& shard : shards) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        above += shard.board.countAbove(score, playerName);
+    }
+    return above;
+}
+
+/**
+ * Best k entries
+ * Up to TOP_K comes straight from the published shard snapshots
+ */
+std::vector<ConcurrentLeaderboard::Entry> ConcurrentLeaderboard::top(int count) const {
+    if (count <= 0) {
+        return std::vector<Entry>();
+    }
+    if (count > TOP_K) {
+        return collectTop(count);
+    }
+
+    std::shared_ptr<const std::vector<Entry>> snapshots[SHARD_COUNT];
+    std::vector<const std::vector<Entry>*> lists;
+    lists.reserve(SHARD_COUNT);
+    for (int i = 0; i < SHARD_COUNT; i++) {
+        snapshots[i] = std::atomic_load(&shards[i].top);
+        lists.push_back(snapshots[i].get());
+    }
+
+    return mergeSorted(lists, count);
+}
+
+/**
+ * Best k entries for large k, locking one shard at a time
+ */
+std::vector<ConcurrentLeaderboard::Entry> ConcurrentLeaderboard::collectTop(int count) const {
+    std::vector<std::vector<Entry>> perShard(SHARD_COUNT);
+    std::vector<const std::vector<Entry>*> lists;
+    for (int i = 0; i < SHARD_COUNT; i++) {
+        std::lock_guard<std::mutex> lock(shards[i].mutex);
+        perShard[i] = shards[i].board.top(count);
+        lists.push_back(&perShard[i]);
+    }
+
+    return mergeSorted(lists, count);
+}
+
+/**
+ * Get number of players
+ */
+size_t ConcurrentLeaderboard::size() const {
+    return (size_t)playerCount.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,72 @@
+#ifndef CONCURRENT_LEADERBOARD_H
+#define CONCURRENT_LEADERBOARD_H
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include "Leaderboard.h"
+
+/**
+ * ConcurrentLeaderboard class
+ * Thread-safe leaderboard for many game sessions in one process
+ * Players are spread over SHARD_COUNT shards by name hash; each shard is
+ * an order-statistic Leaderboard behind its own mutex, so writers only
+ * contend when they hit the same shard. Every shard also publishes an
+ * immutable copy of its top TOP_K entries through an atomic shared_ptr,
+ * and top(k) merges those copies without taking any lock
+ * Cross-shard answers (rank, size) are assembled shard by shard and may
+ * miss updates that land while they run
+ * Member: 4 - Scoring system
+ */
+class ConcurrentLeaderboard {
+public:
+    typedef std::pair<std::string, int> Entry;
+
+    static const int SHARD_COUNT = 64;
+    static const int TOP_K = 32;
+
+private:
+    struct alignas(64) Shard {
+        mutable std::mutex mutex;
+        Leaderboard board;
+        std::shared_ptr<const std::vector<Entry>> top;   // Read with atomic_load
+    };
+
+    Shard shards[SHARD_COUNT];
+    std::atomic<long long> playerCount;
+
+    Shard& shardFor(const std::string& playerName);
+    const Shard& shardFor(const std::string& playerName) const;
+
+    // Top entries from every shard, highest first (locks shard by shard)
+    std::vector<Entry> collectTop(int count) const;
+
+public:
+    // Constructor
+    ConcurrentLeaderboard();
+
+    ConcurrentLeaderboard(const ConcurrentLeaderboard&) = delete;
+    ConcurrentLeaderboard& operator=(const ConcurrentLeaderboard&) = delete;
+
+    // Record a score, keeping each player's best; returns true if it changed
+    // added (optional) is set when the player wasn't on the board before
+    bool submit(const std::string& playerName, int score, bool* added = nullptr);
+
+    // Best score of a player, returns false if unknown
+    bool getScore(const std::string& playerName, int& score) const;
+
+    // 1-based rank of a player (0 if unknown) and players above a key
+    int getRank(const std::string& playerName) const;
+    int countAbove(int score, const std::string& playerName) const;
+
+    // Best k entries; k <= TOP_K is served lock-free from the shard snapshots
+    std::vector<Entry> top(int count) const;
+
+    // Number of players
+    size_t size() const;
+};
+
+#endif // CONCURRENT_LEADERBOARD_H
@@ -0,0 +1,228 @@
+#include "DStarLite.h"
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+
+const int DStarLite::INF = std::numeric_limits<int>::max() / 4;
+
+/**
+ * Constructor: Initialize all estimates to infinity and seed the goal
+ */
+DStarLite::DStarLite(const MazeGenerator& maze, int startX, int startY, int goalX, int goalY)
+    : maze(&maze), width(maze.getWidth()), height(maze.getHeight()),
+      startIndex(startY * maze.getWidth() + startX),
+      lastStartIndex(startY * maze.getWidth() + startX),
+      goalIndex(goalY * maze.getWidth() + goalX),
+      km(0), lastExpansions(0) {
+
+    g.assign(width * height, INF);
+    rhs.assign(width * height, INF);
+
+    rhs[goalIndex] = 0;
+    openList.push(QueueEntry(calculateKey(goalIndex), goalIndex));
+}
+
+/**
+ * Manhattan distance between two cells (admissible on a 4-connected grid)
+ */
+int DStarLite::heuristic(int a, int b) const {
+    return std::abs(a % width - b % width) + std::abs(a / width - b / width);
+}
+
+/**
+ * Calculate priority key for a cell
+ */
+DStarLite::Key DStarLite::calculateKey(int cell) const {
+    int best = std::min(g[cell], rhs[cell]);
+    Key key;
+    key.k1 = (best >= INF) ? INF : best + heuristic(startIndex, cell) + km;
+    key.k2 = best;
+    return key;
+}
+
+/**
+ * Check if a cell is currently open
+ */
+bool DStarLite::isPassable(int cell) const {
+    return maze->isValidPath(cell % width, cell / width);
+}
+
+/**
+ * Lowest cost of moving from a cell to a neighbor and on to the goal
+ */
+int DStarLite::bestSuccessorCost(int cell) const {
+    if (!isPassable(cell)) {
+        return INF;  // Closed cells have no outgoing edges
+    }
+
+    int x = cell % width;
+    int y = cell / width;
+    int best = INF;
+
+    const int dx[] = {0, 0, -1, 1};
+    const int dy[] = {-1, 1, 0, 0};
+    for (int i = 0; i < 4; i++) {
+        int nx = x + dx[i];
+        int ny = y + dy[i];
+        if (nx < 0 || nx >= width || ny < 0 || ny >= height) continue;
+
+        int next = ny * width + nx;
+        if (isPassable(next) && g[next] < INF) {
+            best = std::min(best, g[next] + 1);
+        }
+    }
+
+    return best;
+}
+
+/**
+ * Recompute rhs for a cell and queue it if it became inconsistent
+ * Stale heap entries are left in place and skipped when popped
+ */
+void DStarLite::updateVertex(int cell) {
+    if (cell != goalIndex) {
+        rhs[cell] = bestSuccessorCost(cell);
+    }
+    if (g[cell] != rhs[cell]) {
+        openList.push(QueueEntry(calculateKey(cell), cell));
+    }
+}
+
+/**
+ * Update all 4-connected neighbors of a cell
+ */
+void DStarLite::updateNeighbors(int cell) {
+    int x = cell % width;
+    int y = cell / width;
+
+    if (y > 0) updateVertex(cell - width);
+    if (y < height - 1) updateVertex(cell + width);
+    if (x > 0) updateVertex(cell - 1);
+    if (x < width - 1) updateVertex(cell + 1);
+}
+
+/**
+ * Agent moved: shift the key modifier instead of re-keying the whole queue
+ */
+void DStarLite::updateStart(int x, int y) {
+    int newStart = y * width + x;
+    if (newStart == startIndex) return;
+
+    startIndex = newStart;
+    km += heuristic(lastStartIndex, startIndex);
+    lastStartIndex = startIndex;
+}
+
+/**
+ * A cell changed passability: every edge touching it changed cost
+ */
+void DStarLite::notifyCellChanged(int x, int y) {
+    if (x < 0 || x >= width || y < 0 || y >= height) return;
+
+    int cell = y * width + x;
+    updateVertex(cell);
+    updateNeighbors(cell);
+}
+
+/**
+ * Repair the plan, expanding only inconsistent cells that can affect start
+ */
+bool DStarLite::computeShortestPath() {
+    lastExpansions = 0;
+
+    while (!openList.empty()) {
+        QueueEntry top = openList.top();
+        int cell = top.second;
+
+        // Consistent cells were already settled by a newer entry
+        if (g[cell] == rhs[cell]) {
+            openList.pop();
+            continue;
+        }
+
+        // Entry is outdated (km grew or estimates changed), re-key it
+        Key currentKey = calculateKey(cell);
+        if (top.first != currentKey) {
+            openList.pop();
+            openList.push(QueueEntry(currentKey, cell));
+            continue;
+        }
+
+        if (!(top.first < calculateKey(startIndex)) && rhs[startIndex] == g[startIndex]) {
+            break;
+        }
+
+        openList.pop();
+        lastExpansions++;
+
+        if (g[cell] > rhs[cell]) {
+            // Overconsistent: lower g and propagate
+            g[cell] = rhs[cell];
+        } else {
+            // Underconsistent: raise g and recheck this cell too
+            g[cell] = INF;
+            updateVertex(cell);
+        }
+        updateNeighbors(cell);
+    }
+
+    return g[startIndex] < INF;
+}
+
+/**
+ * Get current path by greedily descending g from start
+ */
+std::vector<std::pair<int, int>> DStarLite::getPath() const {
+    std::vector<std::pair<int, int>> path;
+    if (g[startIndex] >= INF) {
+        return path;
+    }
+
+    int current = startIndex;
+    path.push_back(std::make_pair(current % width, current / width));
+
+    const int dx[] = {0, 0, -1, 1};
+    const int dy[] = {-1, 1, 0, 0};
+    int maxSteps = width * height;
+
+    while (current != goalIndex && maxSteps-- > 0) {
+        int x = current % width;
+        int y = current / width;
+        int next = -1;
+        int bestG = INF;
+
+        for (int i = 0; i < 4; i++) {
+            int nx = x + dx[i];
+            int ny = y + dy[i];
+            if (nx < 0 || nx >= width || ny < 0 || ny >= height) continue;
+
+            int cell = ny * width + nx;
+            if (isPassable(cell) && g[cell] < bestG) {
+                bestG = g[cell];
+                next = cell;
+            }
+        }
+
+        if (next == -1) {
+            return std::vector<std::pair<int, int>>();
+        }
+        current = next;
+        path.push_back(std::make_pair(current % width, current / width));
+    }
+
+    return path;
+}
+
+/**
+ * Get current path length in moves
+ */
+int DStarLite::getPathLength() const {
+    return g[startIndex] >= INF ? -1 : g[startIndex];
+}
+
+/**
+ * Get number of nodes expanded by the most recent replan
+ */
+int DStarLite::getLastExpansions() const {
+    return lastExpansions;
+}
@@ -0,0 +1,84 @@
+#ifndef DSTAR_LITE_H
+#define DSTAR_LITE_H
+
+#include <vector>
+#include <queue>
+#include <utility>
+#include <functional>
+#include "MazeGenerator.h"
+
+/**
+ * DStarLite class
+ * Incremental replanner for mazes whose walls change during play
+ * Searches backwards from the exit so the agent can keep moving while
+ * edits only repair the part of the search tree they actually affect
+ * Uses Priority Queue (Min Heap) with lazy deletion
+ * Member: 3 - Pathfinding algorithms
+ */
+class DStarLite {
+private:
+    // Priority key: [min(g, rhs) + h + km, min(g, rhs)]
+    struct Key {
+        int k1, k2;
+        bool operator<(const Key& other) const {
+            return k1 < other.k1 || (k1 == other.k1 && k2 < other.k2);
+        }
+        bool operator>(const Key& other) const { return other < *this; }
+        bool operator!=(const Key& other) const { return k1 != other.k1 || k2 != other.k2; }
+    };
+
+    typedef std::pair<Key, int> QueueEntry;  // (key, cell index)
+
+    struct EntryComparator {
+        bool operator()(const QueueEntry& a, const QueueEntry& b) const {
+            return a.first > b.first;  // Min heap
+        }
+    };
+
+    const MazeGenerator* maze;
+    int width;
+    int height;
+    int startIndex;
+    int lastStartIndex;
+    int goalIndex;
+    int km;                   // Key modifier, grows as the agent moves
+    int lastExpansions;       // Nodes expanded by the most recent replan
+
+    std::vector<int> g;       // Current distance-to-goal estimate
+    std::vector<int> rhs;     // One-step lookahead estimate
+    std::priority_queue<QueueEntry, std::vector<QueueEntry>, EntryComparator> openList;
+
+    // Helper functions
+    int heuristic(int a, int b) const;
+    Key calculateKey(int cell) const;
+    bool isPassable(int cell) const;
+    void updateVertex(int cell);
+    void updateNeighbors(int cell);
+    int bestSuccessorCost(int cell) const;
+
+public:
+    static const int INF;
+
+    // Constructor: plan from (startX, startY) to (goalX, goalY)
+    DStarLite(const MazeGenerator& maze, int startX, int startY, int goalX, int goalY);
+
+    // Agent moved to a new position
+    void updateStart(int x, int y);
+
+    // A cell was opened or closed through MazeGenerator::setWall
+    void notifyCellChanged(int x, int y);
+
+    // Repair the plan, returns true if the goal is reachable
+    bool computeShortestPath();
+
+    // Get current path from start to goal (call computeShortestPath first)
+    std::vector<std::pair<int, int>> getPath() const;
+
+    // Get current path length in moves (-1 if unreachable)
+    int getPathLength() const;
+
+    // Get number of nodes expanded by the most recent replan
+    int getLastExpansions() const;
+};
+
+#endif // DSTAR_LITE_H
@@ -0,0 +1,174 @@
+#include "EventLog.h"
+#include <chrono>
+#include <cstring>
+
+/**
+ * Constructor: Closed log
+ */
+EventLog::EventLog() : running(false), sleeping(false), dropped(0), written(0), pushed(0) {
+}
+
+/**
+ * Destructor: Write out anything still queued
+ */
+EventLog::~EventLog() {
+    close();
+}
+
+/**
+ * Open the log file for appending and start the drainer
+ * A header is written when the file is new
+ */
+bool EventLog::open(const std::string& path) {
+    if (isOpen()) {
+        return true;
+    }
+
+    file.open(path, std::ios::binary | std::ios::app);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    file.seekp(0, std::ios::end);
+    if (file.tellp() == 0) {
+        char header[16] = {'M', 'Z', 'E', 'V', 'L', 'O', 'G', '1'};
+        uint32_t recordSize = sizeof(EventRecord);
+        std::memcpy(header + 8, &recordSize, sizeof(recordSize));
+        file.write(header, sizeof(header));
+        file.flush();
+    }
+
+    running.store(true);
+    drainer = std::thread(&EventLog::drainLoop, this);
+    return true;
+}
+
+/**
+ * Stop the drainer and close the file
+ */
+void EventLog::close() {
+    if (!drainer.joinable()) {
+        return;
+    }
+
+    running.store(false);
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+    }
+    wake.notify_one();
+    drainer.join();
+    file.close();
+}
+
+/**
+ * Check if the log is accepting events
+ */
+bool EventLog::isOpen() const {
+    return drainer.joinable();
+}
+
+/**
+ * Record an event: one timestamp read and one ring push, never blocks
+ * The drainer is only signalled when it went to sleep on an empty ring
+ */
+bool EventLog::record(EventType type, int x, int y, int value) {
+    if (!isOpen()) {
+        return false;
+    }
+
+    EventRecord event;
+    event.timestampNs = now();
+    event.x = x;
+    event.y = y;
+    event.value = value;
+    event.type = (uint8_t)type;
+    event.reserved[0] = event.reserved[1] = event.reserved[2] = 0;
+
+    if (!ring.tryPush(event)) {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    pushed++;
+
+    // Pairs with the fence in drainLoop: either the drainer sees this
+    // record before sleeping, or this sees that it is asleep
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (sleeping.load(std::memory_order_relaxed)) {
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex);
+        }
+        wake.notify_one();
+    }
+    return true;
+}
+
+/**
+ * Wait until the drainer has written every recorded event
+ */
+void EventLog::flush() {
+    while (isOpen() && written.load(std::memory_order_acquire) < pushed) {
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+}
+
+/**
+ * Move one batch from the ring to the file
+ */
+size_t EventLog::drainOnce(EventRecord* buffer) {
+    size_t count = ring.popBatch(buffer, DRAIN_BATCH);
+    if (count > 0) {
+        file.write(reinterpret_cast<const char*>(buffer), count * sizeof(EventRecord));
+        written.fetch_add((long long)count, std::memory_order_release);
+    }
+    return count;
+}
+
+/**
+ * Drainer thread: write batches while events arrive, then flush the stream
+ * and sleep until record() or close() wakes it
+ */
+void EventLog::drainLoop() {
+    EventRecord buffer[DRAIN_BATCH];
+
+    while (running.load(std::memory_order_acquire)) {
+        if (drainOnce(buffer) > 0) {
+            continue;
+        }
+        file.flush();
+
+        std::unique_lock<std::mutex> lock(wakeMutex);
+        sleeping.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        wake.wait(lock, [this]() {
+            return !ring.empty() || !running.load(std::memory_order_acquire);
+        });
+        sleeping.store(false, std::memory_order_relaxed);
+    }
+
+    // Producer has stopped, write whatever is left
+    while (drainOnce(buffer) > 0) {
+    }
+    file.flush();
+}
+
+/**
+ * Get number of events written to the file
+ */
+long long EventLog::getWrittenCount() const {
+    return written.load(std::memory_order_relaxed);
+}
+
+/**
+ * Get number of events dropped because the ring was full
+ */
+long long EventLog::getDroppedCount() const {
+    return dropped.load(std::memory_order_relaxed);
+}
+
+/**
+ * Get steady_clock time in nanoseconds
+ */
+int64_t EventLog::now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
@@ -0,0 +1,99 @@
+#ifndef EVENT_LOG_H
+#define EVENT_LOG_H
+
+#include <string>
+#include <fstream>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <cstdint>
+#include "SpscRing.h"
+
+// Kinds of gameplay events (stored as one byte on disk, append new values only)
+enum class EventType : uint8_t {
+    START = 0,
+    MOVE = 1,
+    UNDO = 2,
+    REDO = 3,
+    REWIND = 4,
+    PICKUP = 5,
+    CAUGHT = 6,
+    FINISH = 7
+};
+
+// One event as written to disk (fixed 24 bytes, native byte order)
+struct EventRecord {
+    int64_t timestampNs;    // steady_clock nanoseconds
+    int32_t x, y;
+    int32_t value;          // Event specific (move count, step, ...)
+    uint8_t type;           // EventType
+    uint8_t reserved[3];
+};
+
+static_assert(sizeof(EventRecord) == 24, "EventRecord layout is part of the file format");
+
+/**
+ * EventLog class
+ * Captures gameplay events without blocking the game loop: the game thread
+ * pushes POD records into an SPSC ring buffer and a background drainer
+ * thread appends them in batches to a binary log file. The drainer sleeps
+ * on a condition variable while the ring is empty, and a push only wakes it
+ * when it is actually asleep, so an idle game costs no wakeups at all
+ * File layout: 16-byte header ("MZEVLOG1", record size, reserved) followed
+ * by EventRecords. If the ring is ever full the event is counted and dropped
+ * rather than waiting on disk I/O
+ * Member: 5 - Game management
+ */
+class EventLog {
+public:
+    static const size_t RING_CAPACITY = 8192;
+    static const size_t DRAIN_BATCH = 512;
+
+private:
+    SpscRing<EventRecord, RING_CAPACITY> ring;
+    std::ofstream file;
+    std::thread drainer;
+    std::atomic<bool> running;
+    std::atomic<bool> sleeping;         // Drainer is (about to be) waiting on wake
+    std::mutex wakeMutex;
+    std::condition_variable wake;
+    std::atomic<long long> dropped;
+    std::atomic<long long> written;
+    long long pushed;                   // Producer side only
+
+    // Drainer thread body
+    void drainLoop();
+    size_t drainOnce(EventRecord* buffer);
+
+public:
+    // Constructor / Destructor (destructor drains and closes)
+    EventLog();
+    ~EventLog();
+
+    EventLog(const EventLog&) = delete;
+    EventLog& operator=(const EventLog&) = delete;
+
+    // Open (append) the log file and start the drainer thread
+    bool open(const std::string& path);
+
+    // Stop the drainer after writing everything queued
+    void close();
+
+    bool isOpen() const;
+
+    // Record an event (game thread only), returns false if it was dropped
+    bool record(EventType type, int x = 0, int y = 0, int value = 0);
+
+    // Block until every queued event has been written
+    void flush();
+
+    // Counters
+    long long getWrittenCount() const;
+    long long getDroppedCount() const;
+
+    // Current steady_clock time in nanoseconds
+    static int64_t now();
+};
+
+#endif // EVENT_LOG_H
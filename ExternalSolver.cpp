@@ -0,0 +1,383 @@
+#include "ExternalSolver.h"
+#include <chrono>
+#include <cstring>
+#include <cstdio>
+#include <algorithm>
+
+#ifndef _WIN32
+#include <unistd.h>
+#include <sys/resource.h>
+#endif
+
+namespace {
+    // Directions in clockwise order: up, right, down, left
+    const int DX[] = {0, 1, 0, -1};
+    const int DY[] = {-1, 0, 1, 0};
+
+    int opposite(int dir) {
+        return (dir + 2) % 4;
+    }
+
+    int markCount(unsigned char marks, int dir) {
+        return (marks >> (dir * 2)) & 3;
+    }
+
+    long long peakResidentKB() {
+#ifdef _WIN32
+        return -1;
+#else
+        struct rusage usage;
+        getrusage(RUSAGE_SELF, &usage);
+        return usage.ru_maxrss;  // Kilobytes on Linux
+#endif
+    }
+}
+
+/**
+ * Constructor: Initialize an unopened solver
+ */
+ExternalSolver::ExternalSolver()
+    : width(0), height(0), rowStride(0),
+      startX(1), startY(1), exitX(0), exitY(0),
+      pagesTouched(0), pagesSinceRelease(0), lastMazePage(-1), lastMarkPage(-1),
+      residentBudgetPages((64LL << 20) / (long long)MappedFile::pageSize()) {
+}
+
+/**
+ * Destructor: remove the marks sidecar if it still exists
+ */
+ExternalSolver::~ExternalSolver() {
+    marksFile.close();
+    if (!marksPath.empty()) {
+        std::remove(marksPath.c_str());
+    }
+}
+
+/**
+ * Map a maze file and work out its geometry
+ * Width is the length of the first line, rows may end in "\n" or "\r\n"
+ */
+bool ExternalSolver::open(const std::string& path) {
+    if (!mazeFile.openReadOnly(path)) {
+        return false;
+    }
+
+    const char* data = mazeFile.data();
+    size_t size = mazeFile.size();
+
+    const char* newline = static_cast<const char*>(std::memchr(data, '\n', size));
+    if (newline == nullptr) {
+        return false;
+    }
+
+    width = newline - data;
+    rowStride = width + 1;
+    if (width > 0 && data[width - 1] == '\r') {
+        width--;
+    }
+
+    // Last row may be missing its line ending
+    height = (int64_t)size / rowStride;
+    if ((int64_t)size % rowStride >= width) {
+        height++;
+    }
+    if (width < 3 || height < 3) {
+        return false;
+    }
+
+    int64_t pages = ((int64_t)size + MappedFile::pageSize() - 1) / MappedFile::pageSize();
+    mazePagesSeen.assign((pages + 63) / 64, 0);
+
+    // Marks: one byte per cell, 2-bit counters for each of the 4 passages
+    marksPath = path + ".marks";
+    if (!marksFile.createReadWrite(marksPath, (size_t)(width * height))) {
+        return false;
+    }
+#ifndef _WIN32
+    // The mapping keeps the sparse file alive, nothing is left behind on exit
+    if (unlink(marksPath.c_str()) == 0) {
+        marksPath.clear();
+    }
+#endif
+
+    int64_t markPages = (width * height + MappedFile::pageSize() - 1) / MappedFile::pageSize();
+    markPagesSeen.assign((markPages + 63) / 64, 0);
+
+    mazeFile.adviseRandom();
+    marksFile.adviseRandom();
+    locateEndpoints();
+    return true;
+}
+
+/**
+ * Limit how much of the mappings may stay resident
+ */
+void ExternalSolver::setResidentBudget(size_t bytes) {
+    residentBudgetPages = std::max<long long>(16, bytes / MappedFile::pageSize());
+}
+
+/**
+ * Record a page access for the report and for the resident budget
+ * Consecutive accesses to the same page are not counted again
+ */
+void ExternalSolver::touch(std::vector<uint64_t>& seen, int64_t& lastPage, int64_t offset) {
+    int64_t page = offset / (int64_t)MappedFile::pageSize();
+    uint64_t bit = 1ULL << (page & 63);
+    uint64_t& word = seen[page >> 6];
+
+    if (!(word & bit)) {
+        word |= bit;
+        pagesTouched++;
+    }
+
+    // Upper bound on pages faulted in since the last release
+    if (page != lastPage) {
+        lastPage = page;
+        if (++pagesSinceRelease >= residentBudgetPages) {
+            mazeFile.releaseResidentPages();
+            marksFile.releaseResidentPages();
+            pagesSinceRelease = 0;
+        }
+    }
+}
+
+/**
+ * Check if a cell is inside the maze and not a wall
+ */
+bool ExternalSolver::isOpenCell(int64_t x, int64_t y) {
+    if (x < 0 || x >= width || y < 0 || y >= height) {
+        return false;
+    }
+    int64_t offset = y * rowStride + x;
+    touch(mazePagesSeen, lastMazePage, offset);
+    return mazeFile.data()[offset] != '#';
+}
+
+/**
+ * Get the marks byte of a cell
+ */
+unsigned char& ExternalSolver::marksAt(int64_t x, int64_t y) {
+    int64_t offset = y * width + x;
+    touch(markPagesSeen, lastMarkPage, offset);
+    return reinterpret_cast<unsigned char*>(marksFile.mutableData())[offset];
+}
+
+/**
+ * Find S and E, checking MazeGenerator's fixed positions before scanning
+ */
+void ExternalSolver::locateEndpoints() {
+    const char* data = mazeFile.data();
+    size_t size = mazeFile.size();
+
+    startX = 1;
+    startY = 1;
+    exitX = width - 2;
+    exitY = height - 2;
+
+    if (data[startY * rowStride + startX] == 'S' && data[exitY * rowStride + exitX] == 'E') {
+        return;
+    }
+
+    // One sequential pass (memchr is vectorized) for hand-made layouts
+    mazeFile.adviseSequential();
+    const char* s = static_cast<const char*>(std::memchr(data, 'S', size));
+    const char* e = static_cast<const char*>(std::memchr(data, 'E', size));
+    if (s != nullptr) {
+        startX = (s - data) % rowStride;
+        startY = (s - data) / rowStride;
+    }
+    if (e != nullptr) {
+        exitX = (e - data) % rowStride;
+        exitY = (e - data) / rowStride;
+    }
+    mazeFile.releaseResidentPages();
+}
+
+/**
+ * Right-hand wall follower: no state besides position and heading
+ */
+bool ExternalSolver::solveWallFollower(Report& report) {
+    int64_t x = startX;
+    int64_t y = startY;
+    int dir = 1;
+    long long limit = 4LL * width * height;
+
+    while (!(x == exitX && y == exitY)) {
+        if (report.stepsWalked > limit) {
+            return false;  // Looping around an island: maze is not simply connected
+        }
+
+        // Prefer right, then straight, then left, then back
+        const int turns[] = {1, 0, 3, 2};
+        bool moved = false;
+        for (int t = 0; t < 4; t++) {
+            int nd = (dir + turns[t]) % 4;
+            if (isOpenCell(x + DX[nd], y + DY[nd])) {
+                dir = nd;
+                x += DX[nd];
+                y += DY[nd];
+                moved = true;
+                break;
+            }
+        }
+        if (!moved) {
+            return false;  // Start is walled in
+        }
+        report.stepsWalked++;
+    }
+
+    return true;
+}
+
+/**
+ * Tremaux's algorithm with passage marks in the sidecar mapping
+ * Every passage is walked at most twice; passages marked exactly once at
+ * the end form a path from start to exit
+ */
+bool ExternalSolver::solveTremaux(Report& report) {
+    int64_t x = startX;
+    int64_t y = startY;
+    int entrance = -1;           // Passage we arrived through
+    long long pathLength = 0;
+
+    while (!(x == exitX && y == exitY)) {
+        unsigned char marks = marksAt(x, y);
+        bool open[4];
+        bool otherMarked = false;
+        for (int d = 0; d < 4; d++) {
+            open[d] = isOpenCell(x + DX[d], y + DY[d]);
+            if (open[d] && d != entrance && markCount(marks, d) > 0) {
+                otherMarked = true;
+            }
+        }
+
+        int choice = -1;
+        if (entrance >= 0 && otherMarked && markCount(marks, entrance) == 1) {
+            // Old junction reached through a fresh passage: turn back
+            choice = entrance;
+        } else {
+            // New junction (or start): take the least-marked other passage
+            int best = 2;
+            for (int d = 0; d < 4; d++) {
+                if (open[d] && d != entrance && markCount(marks, d) < best) {
+                    best = markCount(marks, d);
+                    choice = d;
+                }
+            }
+            // Dead end: go back the way we came
+            if (choice == -1 && entrance >= 0 && markCount(marks, entrance) < 2) {
+                choice = entrance;
+            }
+        }
+
+        if (choice == -1) {
+            return false;  // Every passage used twice: exit unreachable
+        }
+
+        int64_t nx = x + DX[choice];
+        int64_t ny = y + DY[choice];
+
+        // Mark the passage on both of its ends
+        int count = markCount(marks, choice) + 1;
+        marksAt(x, y) = (unsigned char)(marks + (1 << (choice * 2)));
+        unsigned char& far = marksAt(nx, ny);
+        far = (unsigned char)(far + (1 << (opposite(choice) * 2)));
+        pathLength += (count == 1) ? 1 : -1;
+
+        x = nx;
+        y = ny;
+        entrance = opposite(choice);
+        report.stepsWalked++;
+    }
+
+    report.pathLength = pathLength;
+    return true;
+}
+
+/**
+ * Solve from S to E and report time and memory use
+ */
+ExternalSolver::Report ExternalSolver::solve(Method method) {
+    Report report;
+    report.solved = false;
+    report.pathLength = -1;
+    report.stepsWalked = 0;
+    report.pagesTouched = 0;
+    report.peakResidentKB = 0;
+    report.seconds = 0.0;
+
+    if (!mazeFile.isOpen() || !marksFile.isOpen()) {
+        return report;
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+
+    if (method == Method::WallFollower) {
+        report.solved = solveWallFollower(report);
+    } else {
+        report.solved = solveTremaux(report);
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    report.seconds = std::chrono::duration<double>(end - begin).count();
+    report.pagesTouched = pagesTouched;
+    report.peakResidentKB = peakResidentKB();
+
+    return report;
+}
+
+/**
+ * Write the maze with the marked-once path drawn as '*'
+ * Rows are streamed through a fixed buffer, so memory stays constant
+ */
+bool ExternalSolver::writeSolution(const std::string& outputPath) {
+    if (!mazeFile.isOpen() || !marksFile.isOpen()) {
+        return false;
+    }
+
+    FILE* out = std::fopen(outputPath.c_str(), "wb");
+    if (out == nullptr) {
+        return false;
+    }
+
+    mazeFile.adviseSequential();
+    marksFile.adviseSequential();
+
+    const char* data = mazeFile.data();
+    const unsigned char* marks = reinterpret_cast<const unsigned char*>(marksFile.data());
+    std::vector<char> row(width + 1);
+
+    for (int64_t y = 0; y < height; y++) {
+        for (int64_t x = 0; x < width; x++) {
+            char cell = data[y * rowStride + x];
+            unsigned char m = marks[y * width + x];
+            bool onPath = markCount(m, 0) == 1 || markCount(m, 1) == 1 ||
+                          markCount(m, 2) == 1 || markCount(m, 3) == 1;
+            row[x] = (cell == ' ' && onPath) ? '*' : cell;
+        }
+        row[width] = '\n';
+        std::fwrite(row.data(), 1, row.size(), out);
+
+        // Keep resident set bounded while streaming
+        if (y % 4096 == 4095) {
+            mazeFile.releaseResidentPages();
+            marksFile.releaseResidentPages();
+        }
+    }
+
+    return std::fclose(out) == 0;
+}
+
+/**
+ * Get maze width
+ */
+int64_t ExternalSolver::getWidth() const {
+    return width;
+}
+
+/**
+ * Get maze height
+ */
+int64_t ExternalSolver::getHeight() const {
+    return height;
+}
@@ -0,0 +1,85 @@
+#ifndef EXTERNAL_SOLVER_H
+#define EXTERNAL_SOLVER_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "MappedFile.h"
+
+/**
+ * ExternalSolver class
+ * Out-of-core solver for ASCII maze files that may be larger than RAM
+ * Works directly on a memory-mapped maze file ('#' walls, one row per line,
+ * same format as MazeGenerator::printMaze) with bounded working memory:
+ *  - Wall follower: O(1) state, solves any perfect (loop-free) maze
+ *  - Tremaux: passage marks live in a sparse memory-mapped sidecar file,
+ *    works on any maze and leaves the solution marked once
+ * Resident pages are periodically released so RSS stays under a budget
+ * Member: 3 - Pathfinding algorithms
+ */
+class ExternalSolver {
+public:
+    enum class Method { WallFollower, Tremaux };
+
+    // Result of a solve, including memory accounting
+    struct Report {
+        bool solved;
+        long long pathLength;       // Moves on the marked path (Tremaux), -1 otherwise
+        long long stepsWalked;      // Moves actually made by the walker
+        long long peakResidentKB;   // Peak resident set size of the process
+        long long pagesTouched;     // Distinct maze + mark pages accessed
+        double seconds;
+    };
+
+private:
+    MappedFile mazeFile;
+    MappedFile marksFile;
+    std::string marksPath;
+
+    int64_t width;
+    int64_t height;
+    int64_t rowStride;              // Bytes per row including line ending
+    int64_t startX, startY;
+    int64_t exitX, exitY;
+
+    // Pages touched, one bit per page of each mapping
+    std::vector<uint64_t> mazePagesSeen;
+    std::vector<uint64_t> markPagesSeen;
+    long long pagesTouched;
+    long long pagesSinceRelease;
+    int64_t lastMazePage;
+    int64_t lastMarkPage;
+    long long residentBudgetPages;
+
+    // Helper functions
+    bool isOpenCell(int64_t x, int64_t y);
+    unsigned char& marksAt(int64_t x, int64_t y);
+    void touch(std::vector<uint64_t>& seen, int64_t& lastPage, int64_t offset);
+    void locateEndpoints();
+    bool solveWallFollower(Report& report);
+    bool solveTremaux(Report& report);
+
+public:
+    // Constructor
+    ExternalSolver();
+    ~ExternalSolver();
+
+    // Map a maze file, returns false if it cannot be mapped or parsed
+    bool open(const std::string& path);
+
+    // Limit how much of the mappings may stay resident (default 64 MB)
+    void setResidentBudget(size_t bytes);
+
+    // Solve from S to E with the chosen method
+    Report solve(Method method);
+
+    // Write a copy of the maze with the Tremaux path drawn as '*'
+    // Streams both mappings sequentially; only valid after a Tremaux solve
+    bool writeSolution(const std::string& outputPath);
+
+    // Get dimensions
+    int64_t getWidth() const;
+    int64_t getHeight() const;
+};
+
+#endif // EXTERNAL_SOLVER_H
@@ -0,0 +1,123 @@
+#include "FlowField.h"
+#include <algorithm>
+#include <cstdlib>
+
+/**
+ * Constructor: Allocate per-cell arrays once
+ */
+FlowField::FlowField(const MazeGenerator& maze)
+    : maze(&maze), width(maze.getWidth()), height(maze.getHeight()),
+      targetIndex(-1), treeShaped(false) {
+    nextCell.assign(width * height, -1);
+    distance.assign(width * height, -1);
+    queue.reserve(width * height);
+}
+
+/**
+ * Rebuild the field with a BFS outward from the target
+ * Each discovered cell points back at the cell it was discovered from,
+ * which is one step closer to the target
+ */
+void FlowField::compute(int targetX, int targetY) {
+    std::fill(nextCell.begin(), nextCell.end(), -1);
+    std::fill(distance.begin(), distance.end(), -1);
+    queue.clear();
+    treeShaped = false;
+
+    if (targetX < 0 || targetX >= width || targetY < 0 || targetY >= height ||
+        !maze->isValidPath(targetX, targetY)) {
+        targetIndex = -1;
+        return;
+    }
+
+    targetIndex = targetY * width + targetX;
+    nextCell[targetIndex] = targetIndex;
+    distance[targetIndex] = 0;
+    queue.push_back(targetIndex);
+
+    // Directions: up, down, left, right
+    const int dx[] = {0, 0, -1, 1};
+    const int dy[] = {-1, 1, 0, 0};
+
+    // Count open adjacencies (each edge seen twice) to detect loops
+    long long edgeEnds = 0;
+
+    for (size_t head = 0; head < queue.size(); head++) {
+        int current = queue[head];
+        int x = current % width;
+        int y = current / width;
+
+        for (int i = 0; i < 4; i++) {
+            int nx = x + dx[i];
+            int ny = y + dy[i];
+            if (nx < 0 || nx >= width || ny < 0 || ny >= height) continue;
+            if (!maze->isValidPath(nx, ny)) continue;
+
+            edgeEnds++;
+            int next = ny * width + nx;
+            if (distance[next] == -1) {
+                distance[next] = distance[current] + 1;
+                nextCell[next] = current;
+                queue.push_back(next);
+            }
+        }
+    }
+
+    // A connected region is a tree exactly when edges = nodes - 1
+    treeShaped = (edgeEnds / 2 == (long long)queue.size() - 1);
+}
+
+/**
+ * Move the target, rerooting incrementally when possible
+ * In a tree, when the target steps from p to a neighbor q, every cell's
+ * route still passes through the same next cell, except p (now points at q)
+ * and q (now the target), so only two entries change
+ */
+void FlowField::moveTarget(int targetX, int targetY) {
+    if (targetIndex == -1 || !treeShaped ||
+        targetX < 0 || targetX >= width || targetY < 0 || targetY >= height) {
+        compute(targetX, targetY);
+        return;
+    }
+
+    int newTarget = targetY * width + targetX;
+    if (newTarget == targetIndex) return;
+
+    int oldX = targetIndex % width;
+    int oldY = targetIndex / width;
+    bool adjacent = std::abs(oldX - targetX) + std::abs(oldY - targetY) == 1;
+
+    if (!adjacent || nextCell[newTarget] != targetIndex) {
+        compute(targetX, targetY);
+        return;
+    }
+
+    nextCell[targetIndex] = newTarget;
+    nextCell[newTarget] = newTarget;
+    targetIndex = newTarget;
+}
+
+/**
+ * Get next position toward the target (O(1) lookup)
+ */
+std::pair<int, int> FlowField::nextStep(int x, int y) const {
+    if (x < 0 || x >= width || y < 0 || y >= height) {
+        return std::make_pair(x, y);
+    }
+
+    int next = nextCell[y * width + x];
+    if (next == -1) {
+        return std::make_pair(x, y);
+    }
+    return std::make_pair(next % width, next / width);
+}
+
+/**
+ * Get number of moves from (x, y) to the target
+ */
+int FlowField::distanceAt(int x, int y) const {
+    if (x < 0 || x >= width || y < 0 || y >= height) {
+        return -1;
+    }
+    return distance[y * width + x];
+}
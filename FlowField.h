@@ -0,0 +1,49 @@
+#ifndef FLOW_FIELD_H
+#define FLOW_FIELD_H
+
+#include <vector>
+#include <utility>
+#include "MazeGenerator.h"
+
+/**
+ * FlowField class
+ * Shared reverse-BFS field toward a single target (the player)
+ * One compute() per target move stores, for every open cell, the next cell
+ * on a shortest route to the target, so any number of agents can step
+ * with a single O(1) lookup each
+ * Uses Queue (BFS) over flat per-cell arrays
+ * Member: 3 - Pathfinding algorithms
+ */
+class FlowField {
+private:
+    const MazeGenerator* maze;
+    int width;
+    int height;
+    int targetIndex;
+    bool treeShaped;             // Reached region has no loops (perfect maze)
+
+    std::vector<int> nextCell;   // Next cell toward target, -1 = unreachable
+    std::vector<int> distance;   // Moves to target, -1 = unreachable
+    std::vector<int> queue;      // BFS queue, reused between computes
+
+public:
+    // Constructor: allocate field for the maze, no target yet
+    explicit FlowField(const MazeGenerator& maze);
+
+    // Rebuild the field toward (targetX, targetY)
+    // Must be called again after any wall edit
+    void compute(int targetX, int targetY);
+    
+    // Target moved: reroots the field in O(1) when the target stepped to an
+    // adjacent cell of a loop-free maze, otherwise falls back to compute()
+    void moveTarget(int targetX, int targetY);
+
+    // Next position from (x, y) toward the target (same cell if none)
+    std::pair<int, int> nextStep(int x, int y) const;
+
+    // Moves from (x, y) to the target as of the last full compute()
+    // (-1 if unreachable)
+    int distanceAt(int x, int y) const;
+};
+
+#endif // FLOW_FIELD_H
@@ -0,0 +1,266 @@
+#include "FrameRenderer.h"
+#include <iostream>
+#include <cstdio>
+#include <cstring>
+
+#ifdef _WIN32
+    #include <windows.h>
+    #ifndef ENABLE_VIRTUAL_TERMINAL_PROCESSING
+        #define ENABLE_VIRTUAL_TERMINAL_PROCESSING 0x0004
+    #endif
+#else
+    #include <unistd.h>
+    #include <cerrno>
+#endif
+
+namespace {
+
+// Unchanged cells up to this many are rewritten instead of jumping the
+// cursor over them (a cursor move costs 6+ bytes)
+const int MAX_SKIP_REWRITE = 4;
+
+} // namespace
+
+/**
+ * Constructor: Nothing on screen is known yet
+ */
+FrameRenderer::FrameRenderer() : width(0), height(0), fullRedraw(true) {
+#ifdef _WIN32
+    // Let the console interpret the ANSI sequences (Windows 10+)
+    HANDLE console = GetStdHandle(STD_OUTPUT_HANDLE);
+    DWORD mode = 0;
+    if (GetConsoleMode(console, &mode)) {
+        SetConsoleMode(console, mode | ENABLE_VIRTUAL_TERMINAL_PROCESSING);
+    }
+#endif
+}
+
+/**
+ * Start a frame of the given size
+ */
+void FrameRenderer::resize(int width, int height) {
+    if (width == this->width && height == this->height) {
+        return;
+    }
+    this->width = width;
+    this->height = height;
+    glyphs.assign((size_t)width * height, ' ');
+    shown.assign((size_t)width * height, ' ');
+    fullRedraw = true;
+}
+
+/**
+ * Set one cell of the frame being composed
+ */
+void FrameRenderer::setCell(int x, int y, char glyph) {
+    glyphs[(size_t)y * width + x] = glyph;
+}
+
+/**
+ * Get one cell of the frame being composed
+ */
+char FrameRenderer::getCell(int x, int y) const {
+    return glyphs[(size_t)y * width + x];
+}
+
+/**
+ * Get frame width
+ */
+int FrameRenderer::getWidth() const {
+    return width;
+}
+
+/**
+ * Get frame height
+ */
+int FrameRenderer::getHeight() const {
+    return height;
+}
+
+/**
+ * Get the status text stream for this frame
+ */
+std::ostringstream& FrameRenderer::status() {
+    return statusText;
+}
+
+/**
+ * Forget what is on screen
+ */
+void FrameRenderer::invalidate() {
+    fullRedraw = true;
+}
+
+/**
+ * Append a cursor-position sequence (0-based cell to 1-based terminal)
+ */
+void FrameRenderer::moveCursor(int x, int y) {
+    output += "\033[";
+    output += std::to_string(y + 1);
+    output += ';';
+    output += std::to_string(x + 1);
+    output += 'H';
+}
+
+/**
+ * Draw the frame: changed cells, then the status text below it
+ */
+size_t FrameRenderer::present() {
+    size_t bytes = emit(statusText.str());
+    statusText.str("");
+    statusText.clear();
+    return bytes;
+}
+
+/**
+ * Copy the composed frame into a snapshot
+ */
+void FrameRenderer::exportFrame(Frame& frame) {
+    frame.width = width;
+    frame.height = height;
+    frame.glyphs.assign(glyphs.begin(), glyphs.end());
+    frame.status = statusText.str();
+    frame.fullRedraw = fullRedraw;
+
+    statusText.str("");
+    statusText.clear();
+    fullRedraw = false;
+}
+
+/**
+ * Draw a snapshot composed by another renderer
+ */
+size_t FrameRenderer::present(const Frame& frame) {
+    resize(frame.width, frame.height);
+    glyphs.assign(frame.glyphs.begin(), frame.glyphs.end());
+    if (frame.fullRedraw) {
+        fullRedraw = true;
+    }
+    return emit(frame.status);
+}
+
+/**
+ * Build and write the diff against the frame on screen
+ */
+size_t FrameRenderer::emit(const std::string& status) {
+    output.clear();
+    if (fullRedraw) {
+        output += "\033[0m\033[H\033[2J";
+    }
+
+    // Every frame ends with the default color, so that's where we start
+    Color current = Color::DEFAULT;
+    int cursorX = -1;
+    int cursorY = -1;
+
+    for (int y = 0; y < height; y++) {
+        const char* row = glyphs.data() + (size_t)y * width;
+        const char* old = shown.data() + (size_t)y * width;
+        if (!fullRedraw && std::memcmp(row, old, width) == 0) {
+            continue;
+        }
+
+        for (int x = 0; x < width; x++) {
+            if (!fullRedraw && row[x] == old[x]) {
+                continue;
+            }
+
+            // Short gap on the same row: rewrite it, else jump the cursor
+            if (cursorY == y && x > cursorX && x - cursorX <= MAX_SKIP_REWRITE) {
+                for (int skip = cursorX; skip < x; skip++) {
+                    Color color = colorOf(row[skip]);
+                    if (color != current) {
+                        output += colorCode(color);
+                        current = color;
+                    }
+                    output += row[skip];
+                }
+            } else if (cursorY != y || cursorX != x) {
+                moveCursor(x, y);
+            }
+
+            Color color = colorOf(row[x]);
+            if (color != current) {
+                output += colorCode(color);
+                current = color;
+            }
+            output += row[x];
+            cursorX = x + 1;
+            cursorY = y;
+        }
+    }
+
+    if (current != Color::DEFAULT) {
+        output += colorCode(Color::DEFAULT);
+    }
+
+    // Status lines are rewritten every frame below the maze
+    moveCursor(0, height);
+    output += "\033[J";
+    output += status;
+
+    shown = glyphs;
+    fullRedraw = false;
+
+    writeOutput();
+    return output.size();
+}
+
+/**
+ * Send the frame to the terminal in one write
+ */
+void FrameRenderer::writeOutput() {
+    // Anything already printed the usual way goes first
+    std::cout.flush();
+    std::fflush(stdout);
+
+#ifdef _WIN32
+    std::fwrite(output.data(), 1, output.size(), stdout);
+    std::fflush(stdout);
+#else
+    const char* data = output.data();
+    size_t remaining = output.size();
+    while (remaining > 0) {
+        ssize_t written = ::write(STDOUT_FILENO, data, remaining);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+        data += written;
+        remaining -= (size_t)written;
+    }
+#endif
+}
+
+/**
+ * Get the color a glyph is drawn in
+ */
+FrameRenderer::Color FrameRenderer::colorOf(char glyph) {
+    switch (glyph) {
+        case 'P': return Color::GREEN;
+        case 'E':
+        case 'X': return Color::RED;
+        case 'S': return Color::BLUE;
+        case '*': return Color::YELLOW;
+        case '$': return Color::CYAN;
+        case '.': return Color::MAGENTA;
+        default:  return Color::DEFAULT;
+    }
+}
+
+/**
+ * Get the ANSI sequence selecting a color
+ */
+const char* FrameRenderer::colorCode(Color color) {
+    switch (color) {
+        case Color::RED:     return "\033[31m";
+        case Color::GREEN:   return "\033[32m";
+        case Color::BLUE:    return "\033[34m";
+        case Color::YELLOW:  return "\033[33m";
+        case Color::CYAN:    return "\033[36m";
+        case Color::MAGENTA: return "\033[35m";
+        default:             return "\033[0m";
+    }
+}
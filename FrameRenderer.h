@@ -0,0 +1,91 @@
+#ifndef FRAME_RENDERER_H
+#define FRAME_RENDERER_H
+
+#include <string>
+#include <vector>
+#include <sstream>
+#include <cstdint>
+
+/**
+ * FrameRenderer class
+ * Double-buffered terminal renderer for the maze view
+ * A frame is composed into a glyph buffer, then present() compares it with
+ * the frame already on screen and emits only the cells that changed, each
+ * run placed with one cursor-position sequence. Colors follow the glyph
+ * and are only switched when they differ from the previous cell written.
+ * The cell updates and the status lines below the maze are built in one
+ * string and sent with a single write()
+ * A composed frame can also be exported as a Frame snapshot and presented
+ * by another FrameRenderer (e.g. on a render thread)
+ * Member: 6 - Utility + Display
+ */
+class FrameRenderer {
+public:
+    enum class Color : uint8_t {
+        DEFAULT,
+        RED,
+        GREEN,
+        BLUE,
+        YELLOW,
+        CYAN,
+        MAGENTA
+    };
+
+    // A composed frame, detached from the renderer that built it
+    struct Frame {
+        int width = 0;
+        int height = 0;
+        std::vector<char> glyphs;
+        std::string status;
+        bool fullRedraw = false;
+    };
+
+private:
+    int width;
+    int height;
+    std::vector<char> glyphs;   // Frame being composed (row-major)
+    std::vector<char> shown;    // Frame currently on screen
+    bool fullRedraw;            // Screen contents unknown: clear and draw all
+    std::ostringstream statusText;
+    std::string output;         // Reused frame output buffer
+
+    void moveCursor(int x, int y);
+    void writeOutput();
+    size_t emit(const std::string& status);
+
+public:
+    // Constructor: the first present() clears the screen
+    FrameRenderer();
+
+    // Start a frame of the given size (a size change forces a full redraw)
+    void resize(int width, int height);
+
+    // Set one cell of the frame being composed
+    void setCell(int x, int y, char glyph);
+    char getCell(int x, int y) const;
+
+    int getWidth() const;
+    int getHeight() const;
+
+    // Text drawn below the maze this frame (use colorCode() for colors)
+    std::ostringstream& status();
+
+    // Forget what is on screen (after other output), next frame redraws fully
+    void invalidate();
+
+    // Draw the frame: changed cells, then the status text below it
+    // Returns the number of bytes written
+    size_t present();
+
+    // Copy the composed frame and status into a snapshot (clears the status)
+    void exportFrame(Frame& frame);
+
+    // Draw a snapshot composed by another renderer
+    size_t present(const Frame& frame);
+
+    // Color used for a glyph, and the escape sequence selecting a color
+    static Color colorOf(char glyph);
+    static const char* colorCode(Color color);
+};
+
+#endif // FRAME_RENDERER_H
@@ -6,7 +6,8 @@
 /**
  * Constructor: Initialize game manager
  */
-GameManager::GameManager() : currentLevel(1), score(0), gameStartTime(0), gameEndTime(0) {
+GameManager::GameManager() : newPlayers(0), currentLevel(1), score(0), gameStartTime(0),
+                             gameEndTime(0), scoreJournal(SCORE_FILE, JOURNAL_FILE) {
     loadScores();
 }
 
@@ -16,36 +17,56 @@ GameManager::GameManager() : currentLevel(1), score(0), gameStartTime(0), gameEn
 void GameManager::startGame(int level) {
     currentLevel = level;
     score = 0;
-    gameStartTime = Utilities::getCurrentTime();
+    gameStartTime = Utilities::getCurrentTimeMs();
     gameEndTime = 0;
+    telemetry.reset();
     
-    // Clear event queue
-    while (!eventQueue.empty()) {
-        eventQueue.pop();
+    // Start the event log drainer on first use
+    if (!eventLog.isOpen()) {
+        eventLog.open(EVENT_FILE);
     }
     
-    addEvent("START", 0, 0);
+    addEvent(EventType::START, 0, 0, level);
 }
 
 /**
  * End game and calculate final score
  */
-int GameManager::endGame(int moves, long long timeTaken, int shortestPathLength) {
-    gameEndTime = Utilities::getCurrentTime();
+int GameManager::endGame(int moves, long long timeTakenMs, int shortestPathLength) {
+    gameEndTime = Utilities::getCurrentTimeMs();
     
-    // Calculate score based on moves, time, and efficiency
-    int efficiency = calculateEfficiency(moves, shortestPathLength);
-    int timeBonus = std::max(0, 1000 - (int)timeTaken);  // Bonus for faster completion
-    int moveBonus = std::max(0, 500 - moves);  // Bonus for fewer moves
-    
-    score = efficiency * 10 + timeBonus + moveBonus;
+    score = computeScore(moves, timeTakenMs, shortestPathLength);
     
-    addEvent("FINISH", 0, 0);
+    addEvent(EventType::FINISH, 0, 0, score);
     processEvents();
     
     return score;
 }
 
+/**
+ * Calculate score based on moves, time, and efficiency
+ * Scores are counted in thousandths of a point, so the time bonus (one
+ * point per second under 1000) keeps millisecond resolution: two runs a
+ * few milliseconds apart no longer tie. The other terms are scaled to
+ * keep their weight
+ * Version 1 is the whole-point formula older replay files were scored
+ * with (time bonus rounded to the nearest second)
+ */
+int GameManager::computeScore(int moves, long long timeTakenMs, int shortestPathLength,
+                              int scoreVersion) {
+    int efficiency = calculateEfficiency(moves, shortestPathLength);
+    long long remainingMs = std::max(0LL, 1000000LL - timeTakenMs);  // Under 1000 s
+    int moveBonus = std::max(0, 500 - moves);  // Bonus for fewer moves
+    
+    if (scoreVersion < 2) {
+        int timeBonus = (int)((remainingMs + 500) / 1000);
+        return efficiency * 10 + timeBonus + moveBonus;
+    }
+    
+    int timeBonus = (int)remainingMs;  // Bonus for faster completion
+    return (efficiency * 10 + moveBonus) * SCORE_SCALE + timeBonus;
+}
+
 /**
  * Update score
  */
@@ -68,66 +89,146 @@ int GameManager::getLevel() const {
 }
 
 /**
- * Add event to queue
+ * Record a gameplay event
+ * Only stamps and pushes a 24-byte record, the drainer thread does the I/O
  */
-void GameManager::addEvent(const std::string& eventType, int x, int y) {
-    GameEvent event(eventType, x, y);
-    event.timestamp = Utilities::getCurrentTime();
-    eventQueue.push(event);
+void GameManager::addEvent(EventType type, int x, int y, int value) {
+    eventLog.record(type, x, y, value);
 }
 
 /**
- * Process events from queue
+ * Process events: wait for the drainer to write everything recorded so far
  */
 void GameManager::processEvents() {
-    // Process events (can be used for logging or replay)
-    while (!eventQueue.empty()) {
-        GameEvent event = eventQueue.front();
-        eventQueue.pop();
-        // Events can be logged or processed here
-    }
+    eventLog.flush();
 }
 
 /**
  * Add player score to leaderboard
+ * The claimed score only counts if re-simulating the replay reproduces it
  */
-void GameManager::addScore(const std::string& playerName, int score) {
-    // Update score if player exists and new score is higher
-    if (scoreMap.find(playerName) != scoreMap.end()) {
-        if (score > scoreMap[playerName]) {
-            scoreMap[playerName] = score;
+bool GameManager::addScore(const std::string& playerName, const ReplayRecord& replay) {
+    // Whole-point replays can't be ranked against millisecond scores
+    if (replay.scoreVersion != ReplayRecord::SCORE_VERSION ||
+        ReplayVerifier::verify(replay) != ReplayVerifier::Verdict::VALID) {
+        return false;
+    }
+    
+    int score = replay.claimedScore;
+    
+    // Update score if player is new or beat their best (O(log n))
+    // Only the update is journaled (O(1) I/O, written off this thread)
+    bool compact = false;
+    {
+        std::shared_lock<std::shared_mutex> lock(journalOrder);
+        if (recordScore(playerName, score)) {
+            scoreJournal.append(playerName, score);
+            compact = scoreJournal.needsCompaction();
         }
-    } else {
-        scoreMap[playerName] = score;
+    }
+    if (compact) {
+        saveScores();
     }
     
-    saveScores();
+    ReplayRecord stored = replay;
+    stored.playerName = playerName;
+    saveReplay(stored);
+    return true;
 }
 
 /**
  * Get top scores (sorted)
- * Uses sorting algorithm to return top N scores
+ * Merges the first snapshot records with the overlay's top entries;
+ * snapshot records replaced by the overlay are skipped
  */
 std::vector<std::pair<std::string, int>> GameManager::getTopScores(int count) {
+    std::vector<std::pair<std::string, int>> overlay = leaderboard.top(count);
     std::vector<std::pair<std::string, int>> scores;
     
-    // Copy from HashMap to vector
-    for (const auto& pair : scoreMap) {
-        scores.push_back(pair);
+    size_t next = 0;
+    size_t rank = 0;
+    int overlayScore;
+    while ((int)scores.size() < count && (rank < scoreFile.size() || next < overlay.size())) {
+        if (rank < scoreFile.size()) {
+            std::string name = scoreFile.nameAt(rank);
+            int stored = scoreFile.scoreAt(rank);
+            if (leaderboard.getScore(name, overlayScore)) {
+                rank++;
+                continue;
+            }
+            if (next == overlay.size() || stored > overlay[next].second ||
+                (stored == overlay[next].second && name < overlay[next].first)) {
+                scores.push_back(std::make_pair(name, stored));
+                rank++;
+                continue;
+            }
+        }
+        scores.push_back(overlay[next++]);
     }
     
-    // Sort by score (descending order)
-    std::sort(scores.begin(), scores.end(), 
-        [](const std::pair<std::string, int>& a, const std::pair<std::string, int>& b) {
-            return a.second > b.second;
-        });
+    return scores;
+}
+
+/**
+ * Get a player's leaderboard rank (1 = best, 0 = not ranked)
+ * Players above = overlay players above + snapshot players above that the
+ * overlay hasn't replaced, all O(log n)
+ */
+int GameManager::getPlayerRank(const std::string& playerName) const {
+    int best;
+    size_t index;
+    if (!leaderboard.getScore(playerName, best)) {
+        if (!scoreFile.find(playerName, index)) {
+            return 0;
+        }
+        best = scoreFile.scoreAt(index);
+    }
     
-    // Return top N scores
-    if (scores.size() > count) {
-        scores.resize(count);
+    size_t snapshotAbove = scoreFile.countAbove(best, playerName);
+    size_t replaced;
+    {
+        std::lock_guard<std::mutex> lock(shadowMutex);
+        replaced = std::lower_bound(shadowedRanks.begin(), shadowedRanks.end(), snapshotAbove)
+                   - shadowedRanks.begin();
     }
     
-    return scores;
+    return (int)(snapshotAbove - replaced) + leaderboard.countAbove(best, playerName) + 1;
+}
+
+/**
+ * Get number of ranked players
+ */
+int GameManager::getPlayerCount() const {
+    return (int)scoreFile.size() + newPlayers.load();
+}
+
+/**
+ * Record a score in the overlay if it beats the player's stored best
+ * Safe to call from several threads: the overlay reports which call
+ * added a player, so the bookkeeping below happens exactly once
+ */
+bool GameManager::recordScore(const std::string& playerName, int score) {
+    size_t index;
+    bool inSnapshot = scoreFile.find(playerName, index);
+    if (inSnapshot && score <= scoreFile.scoreAt(index)) {
+        return false;
+    }
+    
+    bool added = false;
+    if (!leaderboard.submit(playerName, score, &added)) {
+        return false;
+    }
+    
+    if (added) {
+        if (inSnapshot) {
+            std::lock_guard<std::mutex> lock(shadowMutex);
+            shadowedRanks.insert(std::upper_bound(shadowedRanks.begin(), shadowedRanks.end(), index),
+                                 index);
+        } else {
+            newPlayers++;
+        }
+    }
+    return true;
 }
 
 /**
@@ -145,51 +246,102 @@ int GameManager::calculateEfficiency(int playerMoves, int shortestPathLength) {
 }
 
 /**
- * Get game time elapsed
+ * Get game time elapsed in seconds
  */
 long long GameManager::getElapsedTime() const {
+    return getElapsedTimeMs() / 1000;
+}
+
+/**
+ * Get game time elapsed in milliseconds
+ */
+long long GameManager::getElapsedTimeMs() const {
     if (gameEndTime > 0) {
         return gameEndTime - gameStartTime;
     }
-    return Utilities::getCurrentTime() - gameStartTime;
+    return Utilities::getCurrentTimeMs() - gameStartTime;
+}
+
+/**
+ * Get session telemetry
+ */
+Telemetry& GameManager::getTelemetry() {
+    return telemetry;
+}
+
+/**
+ * Append the session's timing summary to the telemetry file
+ */
+bool GameManager::saveTelemetry() const {
+    return telemetry.saveSummary(TELEMETRY_FILE);
 }
 
 /**
- * Load scores from file
+ * Load scores: map the snapshot (O(1)) and apply the journal on top
+ * The journal is bounded by compaction, so startup cost doesn't grow with
+ * the number of stored scores
  */
 void GameManager::loadScores() {
-    std::ifstream file(SCORE_FILE);
+    if (!scoreFile.open(SCORE_FILE)) {
+        importLegacyScores();
+    }
+    
+    for (const auto& entry : scoreJournal.recover()) {
+        recordScore(entry.first, entry.second);
+    }
+}
+
+/**
+ * One-time import of the old text score file into the binary snapshot
+ * Its scores are whole points, so they are scaled to thousandths
+ */
+void GameManager::importLegacyScores() {
+    std::ifstream file(LEGACY_SCORE_FILE);
     if (!file.is_open()) {
-        return;  // File doesn't exist yet, that's okay
+        return;  // File doesn't exist, that's okay
     }
     
     std::string line;
+    bool imported = false;
     while (std::getline(file, line)) {
         std::istringstream iss(line);
         std::string name;
         int score;
         
         if (iss >> name >> score) {
-            scoreMap[name] = score;
+            score = std::max(-MAX_LEGACY_SCORE, std::min(MAX_LEGACY_SCORE, score));
+            imported = recordScore(name, score * SCORE_SCALE) || imported;
         }
     }
     
-    file.close();
+    if (imported) {
+        saveScores();
+    }
 }
 
 /**
- * Save scores to file
+ * Save scores: compact the journal into a fresh snapshot
+ * The background writer merges the overlay into the snapshot file
  */
 void GameManager::saveScores() {
-    std::ofstream file(SCORE_FILE);
-    if (!file.is_open()) {
-        return;  // Couldn't open file for writing
-    }
+    std::unique_lock<std::shared_mutex> lock(journalOrder);
+    scoreJournal.compact(leaderboard.top((int)leaderboard.size()));
+}
+
+/**
+ * Append an accepted replay to the replay file
+ * Names are stored as one token so the line stays parseable; appends are
+ * serialized so lines from concurrent sessions never interleave
+ */
+void GameManager::saveReplay(const ReplayRecord& replay) {
+    ReplayRecord stored = replay;
+    std::replace(stored.playerName.begin(), stored.playerName.end(), ' ', '_');
+    std::string line = ReplayVerifier::format(stored) + "\n";
     
-    for (const auto& pair : scoreMap) {
-        file << pair.first << " " << pair.second << std::endl;
+    std::lock_guard<std::mutex> lock(replayMutex);
+    std::ofstream file(REPLAY_FILE, std::ios::app);
+    if (!file.is_open()) {
+        return;
     }
-    
-    file.close();
+    file << line << std::flush;
 }
-
@@ -1,54 +1,79 @@
 #ifndef GAME_MANAGER_H
 #define GAME_MANAGER_H
 
-#include <queue>
-#include <unordered_map>
 #include <string>
 #include <vector>
 #include <fstream>
 #include <algorithm>
+#include <mutex>
+#include <shared_mutex>
+#include <atomic>
+#include <climits>
 #include "Player.h"
 #include "MazeGenerator.h"
 #include "AIPathfinder.h"
+#include "EventLog.h"
+#include "ReplayVerifier.h"
+#include "ConcurrentLeaderboard.h"
+#include "LeaderboardFile.h"
+#include "ScoreJournal.h"
+#include "Telemetry.h"
 
 /**
  * GameManager class
  * Controls scoring, level progression, and state management
- * Uses Queue for move history and HashMap for score records
+ * Uses a ring-buffered event log and a mapped, ranked leaderboard
+ * Game time is measured on a monotonic clock in milliseconds
  * Member: 4 - Scoring system, Member: 5 - Game management
  */
 class GameManager {
 private:
-    // Queue for move history tracking
-    struct GameEvent {
-        std::string eventType;  // "MOVE", "START", "FINISH", etc.
-        int x, y;
-        long long timestamp;
-        
-        GameEvent(const std::string& type, int x = 0, int y = 0) 
-            : eventType(type), x(x), y(y) {
-            timestamp = 0;  // Will be set when added
-        }
-    };
-    
-    std::queue<GameEvent> eventQueue;
-    
-    // HashMap for score records (player name -> score)
-    std::unordered_map<std::string, int> scoreMap;
+    // Ring-buffered binary event log (opened on first game)
+    EventLog eventLog;
+    
+    // Score records: memory-mapped binary snapshot (O(1) to open) plus
+    // a ranked overlay of newer scores (journal + this session)
+    // The overlay is sharded, so sessions on several threads can submit
+    // scores and read the board concurrently
+    LeaderboardFile scoreFile;
+    ConcurrentLeaderboard leaderboard;
+    std::vector<size_t> shadowedRanks;  // Snapshot ranks replaced by the overlay (sorted)
+    mutable std::mutex shadowMutex;
+    std::atomic<int> newPlayers;        // Overlay players missing from the snapshot
+    
+    // Journal appends (shared) vs. compaction requests (exclusive), so a
+    // compaction always covers every record journaled before it
+    std::shared_mutex journalOrder;
+    
+    // Accepted scores are submitted concurrently; one replay line at a time
+    std::mutex replayMutex;
+    
+    // Per-session latency histograms (move, frame, solve)
+    Telemetry telemetry;
     
     // Current game state
     int currentLevel;
     int score;
-    long long gameStartTime;
+    long long gameStartTime;    // Milliseconds, steady clock
     long long gameEndTime;
     
     // File for saving high scores
-    const std::string SCORE_FILE = "highscores.txt";
+    const std::string SCORE_FILE = "highscores.bin";
+    const std::string LEGACY_SCORE_FILE = "highscores.txt";
+    const std::string EVENT_FILE = "events.bin";
+    const std::string REPLAY_FILE = "replays.txt";
+    const std::string JOURNAL_FILE = "highscores.journal";
+    const std::string TELEMETRY_FILE = "telemetry.txt";
+    
+    // Snapshot + append-only journal of score updates (background writer)
+    ScoreJournal scoreJournal;
     
     // Helper functions
     void loadScores();
+    void importLegacyScores();
     void saveScores();
-    void addEvent(const std::string& eventType, int x = 0, int y = 0);
+    bool recordScore(const std::string& playerName, int score);
+    void saveReplay(const ReplayRecord& replay);
     
 public:
     // Constructor
@@ -57,8 +82,18 @@ public:
     // Start new game
     void startGame(int level = 1);
     
-    // End game and calculate final score
-    int endGame(int moves, long long timeTaken, int shortestPathLength);
+    // End game and calculate final score (time in milliseconds)
+    int endGame(int moves, long long timeTakenMs, int shortestPathLength);
+    
+    // Scores are kept in thousandths of a point, so the time bonus counts
+    // milliseconds; whole-point scores (old files) are multiplied by this
+    static const int SCORE_SCALE = 1000;
+    static const int MAX_LEGACY_SCORE = INT_MAX / SCORE_SCALE;
+    
+    // Score formula used by endGame (pure, so replays can recompute it)
+    // scoreVersion selects the scale a replay was scored on (ReplayRecord)
+    static int computeScore(int moves, long long timeTakenMs, int shortestPathLength,
+                            int scoreVersion = ReplayRecord::SCORE_VERSION);
     
     // Update score
     void updateScore(int points);
@@ -69,21 +104,37 @@ public:
     // Get current level
     int getLevel() const;
     
-    // Process events from queue
+    // Record a gameplay event (non-blocking, game thread only)
+    void addEvent(EventType type, int x = 0, int y = 0, int value = 0);
+    
+    // Wait until recorded events have reached the log file
     void processEvents();
     
-    // Add player score to leaderboard
-    void addScore(const std::string& playerName, int score);
+    // Add a run to the leaderboard after re-simulating its replay
+    // Returns false (and records nothing) if the replay doesn't check out
+    // The score methods may be called from several session threads at once
+    bool addScore(const std::string& playerName, const ReplayRecord& replay);
     
     // Get top scores (sorted)
     std::vector<std::pair<std::string, int>> getTopScores(int count = 10);
     
+    // Leaderboard rank of a player (1 = best, 0 = not ranked) and board size
+    int getPlayerRank(const std::string& playerName) const;
+    int getPlayerCount() const;
+    
     // Calculate efficiency score
     // Returns percentage: (shortestPath / playerMoves) * 100
-    int calculateEfficiency(int playerMoves, int shortestPathLength);
+    static int calculateEfficiency(int playerMoves, int shortestPathLength);
     
-    // Get game time elapsed
+    // Get game time elapsed, in whole seconds and in milliseconds
     long long getElapsedTime() const;
+    long long getElapsedTimeMs() const;
+    
+    // Session timing histograms (reset by startGame)
+    Telemetry& getTelemetry();
+    
+    // Append the session's timing summary to the telemetry file
+    bool saveTelemetry() const;
 };
 
 #endif // GAME_MANAGER_H
@@ -0,0 +1,387 @@
+#include "ImageExporter.h"
+#include "MappedFile.h"
+#include <algorithm>
+#include <cstring>
+#include <cctype>
+
+namespace {
+
+const unsigned char PNG_SIGNATURE[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+const size_t MAX_STORED_BLOCK = 65535;     // Deflate stored block payload limit
+const uint32_t ADLER_MOD = 65521;
+const size_t ADLER_RUN = 5552;             // Longest run before the sums can overflow
+const int RELEASE_INTERVAL = 4096;         // Maze file rows between page releases
+
+/**
+ * Store a 32-bit value big-endian (PNG byte order)
+ */
+void putBigEndian(unsigned char* dest, uint32_t value) {
+    dest[0] = (unsigned char)(value >> 24);
+    dest[1] = (unsigned char)(value >> 16);
+    dest[2] = (unsigned char)(value >> 8);
+    dest[3] = (unsigned char)value;
+}
+
+/**
+ * Build the CRC-32 lookup table (PNG / zlib polynomial)
+ */
+std::vector<uint32_t> buildCrcTable() {
+    std::vector<uint32_t> table(256);
+    for (uint32_t n = 0; n < 256; n++) {
+        uint32_t c = n;
+        for (int k = 0; k < 8; k++) {
+            c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+        }
+        table[n] = c;
+    }
+    return table;
+}
+
+} // namespace
+
+/**
+ * Constructor: No image open
+ */
+ImageExporter::ImageExporter()
+    : out(nullptr), format(Format::PPM), cellsWide(0), cellsHigh(0), pixelsPerCell(1),
+      pixelWidth(0), rowsWritten(0), failed(false), adlerA(1), adlerB(0) {}
+
+/**
+ * Destructor: Close the file (an unfinished image stays truncated)
+ */
+ImageExporter::~ImageExporter() {
+    if (out != nullptr) {
+        std::fclose(out);
+    }
+}
+
+/**
+ * Create the file and write the image header
+ */
+bool ImageExporter::open(const std::string& path, Format format, int width, int height, int pixelsPerCell) {
+    if (out != nullptr || width < 1 || height < 1 || pixelsPerCell < 1) {
+        return false;
+    }
+    int64_t pixelHeight = (int64_t)height * pixelsPerCell;
+    int64_t pixelWidth = (int64_t)width * pixelsPerCell;
+    if (format == Format::PNG && (pixelWidth > 0x7FFFFFFF || pixelHeight > 0x7FFFFFFF)) {
+        return false;
+    }
+
+    out = std::fopen(path.c_str(), "wb");
+    if (out == nullptr) {
+        return false;
+    }
+
+    this->format = format;
+    this->cellsWide = width;
+    this->cellsHigh = height;
+    this->pixelsPerCell = pixelsPerCell;
+    this->pixelWidth = pixelWidth;
+    rowsWritten = 0;
+    failed = false;
+    adlerA = 1;
+    adlerB = 0;
+
+    if (format == Format::PPM) {
+        scanline.assign((size_t)pixelWidth * 3, 0);
+        std::string header = "P6\n" + std::to_string(pixelWidth) + " " +
+                             std::to_string(pixelHeight) + "\n255\n";
+        return writeBytes(header.data(), header.size());
+    }
+
+    // PNG: filter type 0 (None) byte before each scanline of 8-bit RGB
+    scanline.assign(1 + (size_t)pixelWidth * 3, 0);
+
+    unsigned char header[13];
+    putBigEndian(header, (uint32_t)pixelWidth);
+    putBigEndian(header + 4, (uint32_t)pixelHeight);
+    header[8] = 8;      // Bit depth
+    header[9] = 2;      // Color type: truecolor
+    header[10] = 0;     // Compression: deflate
+    header[11] = 0;     // Filter method
+    header[12] = 0;     // No interlace
+    return writeBytes(PNG_SIGNATURE, sizeof(PNG_SIGNATURE)) &&
+           writeChunk("IHDR", header, sizeof(header));
+}
+
+/**
+ * Expand one maze row into a scanline and write it pixelsPerCell times
+ */
+bool ImageExporter::writeRow(const char* cells) {
+    if (out == nullptr || failed || rowsWritten >= cellsHigh) {
+        return false;
+    }
+
+    unsigned char* pixel = scanline.data() + (format == Format::PNG ? 1 : 0);
+    for (int x = 0; x < cellsWide; x++) {
+        unsigned char rgb[3];
+        colorOf(cells[x], rgb);
+        for (int k = 0; k < pixelsPerCell; k++) {
+            pixel[0] = rgb[0];
+            pixel[1] = rgb[1];
+            pixel[2] = rgb[2];
+            pixel += 3;
+        }
+    }
+
+    for (int k = 0; k < pixelsPerCell && !failed; k++) {
+        if (format == Format::PPM) {
+            writeBytes(scanline.data(), scanline.size());
+        } else {
+            bool first = (rowsWritten == 0 && k == 0);
+            bool last = (rowsWritten == cellsHigh - 1 && k == pixelsPerCell - 1);
+            writeScanlinePNG(first, last);
+        }
+    }
+
+    rowsWritten++;
+    return !failed;
+}
+
+/**
+ * Finish the image and close the file
+ */
+bool ImageExporter::close() {
+    if (out == nullptr) {
+        return false;
+    }
+
+    bool ok = !failed && rowsWritten == cellsHigh;
+    if (ok && format == Format::PNG) {
+        ok = writeChunk("IEND", nullptr, 0);
+    }
+    if (std::fclose(out) != 0) {
+        ok = false;
+    }
+    out = nullptr;
+    scanline.clear();
+    chunk.clear();
+    return ok;
+}
+
+/**
+ * Wrap one scanline in stored deflate blocks and write it as an IDAT chunk
+ * The zlib stream spans all IDAT chunks: header before the first scanline,
+ * Adler-32 of the raw data after the last
+ */
+bool ImageExporter::writeScanlinePNG(bool firstScanline, bool lastScanline) {
+    size_t blocks = (scanline.size() + MAX_STORED_BLOCK - 1) / MAX_STORED_BLOCK;
+    chunk.clear();
+    chunk.reserve(2 + blocks * 5 + scanline.size() + 4);
+
+    if (firstScanline) {
+        chunk.push_back(0x78);      // CM = deflate, 32K window
+        chunk.push_back(0x01);      // No preset dictionary, fastest level, check bits
+    }
+
+    for (size_t offset = 0; offset < scanline.size(); offset += MAX_STORED_BLOCK) {
+        size_t length = std::min(MAX_STORED_BLOCK, scanline.size() - offset);
+        bool finalBlock = lastScanline && offset + length == scanline.size();
+        chunk.push_back(finalBlock ? 1 : 0);    // BFINAL, BTYPE = 00 (stored)
+        chunk.push_back((unsigned char)(length & 0xFF));
+        chunk.push_back((unsigned char)(length >> 8));
+        chunk.push_back((unsigned char)(~length & 0xFF));
+        chunk.push_back((unsigned char)((~length >> 8) & 0xFF));
+        chunk.insert(chunk.end(), scanline.begin() + offset, scanline.begin() + offset + length);
+    }
+    updateAdler(scanline.data(), scanline.size());
+
+    if (lastScanline) {
+        unsigned char adler[4];
+        putBigEndian(adler, (adlerB << 16) | adlerA);
+        chunk.insert(chunk.end(), adler, adler + 4);
+    }
+
+    return writeChunk("IDAT", chunk.data(), chunk.size());
+}
+
+/**
+ * Write a PNG chunk: length, type, data, CRC of type and data
+ */
+bool ImageExporter::writeChunk(const char* type, const unsigned char* data, size_t size) {
+    unsigned char header[8];
+    putBigEndian(header, (uint32_t)size);
+    std::memcpy(header + 4, type, 4);
+
+    uint32_t crc = crc32(0, header + 4, 4);
+    if (size > 0) {
+        crc = crc32(crc, data, size);
+    }
+    unsigned char trailer[4];
+    putBigEndian(trailer, crc);
+
+    return writeBytes(header, sizeof(header)) &&
+           (size == 0 || writeBytes(data, size)) &&
+           writeBytes(trailer, sizeof(trailer));
+}
+
+/**
+ * Write raw bytes, remembering any failure
+ */
+bool ImageExporter::writeBytes(const void* data, size_t size) {
+    if (!failed && std::fwrite(data, 1, size, out) != size) {
+        failed = true;
+    }
+    return !failed;
+}
+
+/**
+ * Add bytes to the running Adler-32 checksum
+ */
+void ImageExporter::updateAdler(const unsigned char* data, size_t size) {
+    while (size > 0) {
+        size_t run = std::min(size, ADLER_RUN);
+        for (size_t i = 0; i < run; i++) {
+            adlerA += data[i];
+            adlerB += adlerA;
+        }
+        adlerA %= ADLER_MOD;
+        adlerB %= ADLER_MOD;
+        data += run;
+        size -= run;
+    }
+}
+
+/**
+ * Update a CRC-32 (PNG / zlib polynomial) with more bytes
+ */
+uint32_t ImageExporter::crc32(uint32_t crc, const unsigned char* data, size_t size) {
+    static const std::vector<uint32_t> table = buildCrcTable();
+
+    crc = ~crc;
+    for (size_t i = 0; i < size; i++) {
+        crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+/**
+ * Get the pixel color of a maze glyph
+ */
+void ImageExporter::colorOf(char glyph, unsigned char rgb[3]) {
+    unsigned char r, g, b;
+    switch (glyph) {
+        case '#': r = 24;  g = 24;  b = 32;  break;    // Wall
+        case 'S': r = 40;  g = 90;  b = 220; break;    // Start
+        case 'E': r = 220; g = 40;  b = 40;  break;    // Exit
+        case '*': r = 245; g = 180; b = 0;   break;    // Solution path
+        case '.': r = 200; g = 80;  b = 200; break;    // Explored / marked
+        default:  r = 255; g = 255; b = 255; break;    // Open cell
+    }
+    rgb[0] = r;
+    rgb[1] = g;
+    rgb[2] = b;
+}
+
+/**
+ * Pick the image format from the file extension
+ */
+ImageExporter::Format ImageExporter::formatForPath(const std::string& path) {
+    if (path.size() >= 4) {
+        std::string ext = path.substr(path.size() - 4);
+        for (char& c : ext) {
+            c = (char)std::tolower((unsigned char)c);
+        }
+        if (ext == ".png") {
+            return Format::PNG;
+        }
+    }
+    return Format::PPM;
+}
+
+/**
+ * Export a generated maze with a solution path drawn over its open cells
+ * The path is sorted by row once, then merged into each row as it streams
+ */
+bool ImageExporter::exportMaze(const MazeGenerator& maze,
+                               const std::vector<std::pair<int, int>>& path,
+                               const std::string& outputPath, int pixelsPerCell) {
+    int width = maze.getWidth();
+    int height = maze.getHeight();
+
+    // (y, x) order so each row's cells are one contiguous run
+    std::vector<std::pair<int, int>> byRow;
+    byRow.reserve(path.size());
+    for (const auto& cell : path) {
+        byRow.push_back({cell.second, cell.first});
+    }
+    std::sort(byRow.begin(), byRow.end());
+
+    ImageExporter exporter;
+    if (!exporter.open(outputPath, formatForPath(outputPath), width, height, pixelsPerCell)) {
+        return false;
+    }
+
+    std::vector<char> row(width);
+    size_t next = 0;
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            row[x] = maze.getCell(x, y);
+        }
+        for (; next < byRow.size() && byRow[next].first == y; next++) {
+            int x = byRow[next].second;
+            if (x >= 0 && x < width && row[x] == ' ') {
+                row[x] = '*';
+            }
+        }
+        if (!exporter.writeRow(row.data())) {
+            return false;
+        }
+    }
+
+    return exporter.close();
+}
+
+/**
+ * Export a maze text file through a read-only mapping
+ * Width is the length of the first line, rows may end in "\n" or "\r\n"
+ */
+bool ImageExporter::exportMazeFile(const std::string& mazePath,
+                                   const std::string& outputPath, int pixelsPerCell) {
+    MappedFile mazeFile;
+    if (!mazeFile.openReadOnly(mazePath)) {
+        return false;
+    }
+
+    const char* data = mazeFile.data();
+    size_t size = mazeFile.size();
+    const char* newline = static_cast<const char*>(std::memchr(data, '\n', size));
+    if (newline == nullptr) {
+        return false;
+    }
+
+    int64_t width = newline - data;
+    int64_t rowStride = width + 1;
+    if (width > 0 && data[width - 1] == '\r') {
+        width--;
+    }
+
+    // Last row may be missing its line ending
+    int64_t height = (int64_t)size / rowStride;
+    if ((int64_t)size % rowStride >= width) {
+        height++;
+    }
+    if (width < 1 || height < 1 || width > 0x7FFFFFFF || height > 0x7FFFFFFF) {
+        return false;
+    }
+
+    ImageExporter exporter;
+    if (!exporter.open(outputPath, formatForPath(outputPath), (int)width, (int)height, pixelsPerCell)) {
+        return false;
+    }
+
+    mazeFile.adviseSequential();
+    for (int64_t y = 0; y < height; y++) {
+        if (!exporter.writeRow(data + y * rowStride)) {
+            return false;
+        }
+
+        // Keep resident set bounded while streaming
+        if (y % RELEASE_INTERVAL == RELEASE_INTERVAL - 1) {
+            mazeFile.releaseResidentPages();
+        }
+    }
+
+    return exporter.close();
+}
@@ -0,0 +1,79 @@
+#ifndef IMAGE_EXPORTER_H
+#define IMAGE_EXPORTER_H
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <cstdio>
+#include <cstdint>
+#include "MazeGenerator.h"
+
+/**
+ * ImageExporter class
+ * Streams a maze into a PPM (P6) or PNG image, one maze row at a time
+ * Each cell becomes a square of pixelsPerCell x pixelsPerCell pixels colored
+ * by its glyph (walls, open cells, start, exit and '*' / '.' solution marks)
+ * Only one scanline is held in memory, so the image size is not limited by
+ * RAM. PNG output uses uncompressed (stored) deflate blocks, written as one
+ * IDAT chunk per scanline, so nothing has to be buffered or compressed
+ * Member: 6 - Utility + Display
+ */
+class ImageExporter {
+public:
+    enum class Format { PPM, PNG };
+
+private:
+    FILE* out;
+    Format format;
+    int cellsWide;
+    int cellsHigh;
+    int pixelsPerCell;
+    int64_t pixelWidth;
+    int rowsWritten;
+    bool failed;
+
+    std::vector<unsigned char> scanline;    // PNG: filter byte + RGB, PPM: RGB
+    std::vector<unsigned char> chunk;       // PNG: IDAT payload for one scanline
+    uint32_t adlerA;                        // Running Adler-32 of the raw image data
+    uint32_t adlerB;
+
+    bool writeBytes(const void* data, size_t size);
+    bool writeChunk(const char* type, const unsigned char* data, size_t size);
+    bool writeScanlinePNG(bool firstScanline, bool lastScanline);
+    void updateAdler(const unsigned char* data, size_t size);
+
+    static void colorOf(char glyph, unsigned char rgb[3]);
+    static uint32_t crc32(uint32_t crc, const unsigned char* data, size_t size);
+
+public:
+    // Constructor / Destructor (an unfinished image is closed as is)
+    ImageExporter();
+    ~ImageExporter();
+
+    ImageExporter(const ImageExporter&) = delete;
+    ImageExporter& operator=(const ImageExporter&) = delete;
+
+    // Start an image of width x height cells
+    bool open(const std::string& path, Format format, int width, int height, int pixelsPerCell = 1);
+
+    // Append the next maze row (width glyphs)
+    bool writeRow(const char* cells);
+
+    // Finish the file; fails unless every row was written
+    bool close();
+
+    // ".png" selects PNG, anything else PPM
+    static Format formatForPath(const std::string& path);
+
+    // Export a generated maze, with an optional solution path drawn over it
+    static bool exportMaze(const MazeGenerator& maze,
+                           const std::vector<std::pair<int, int>>& path,
+                           const std::string& outputPath, int pixelsPerCell = 1);
+
+    // Export a maze text file (e.g. a --solve-file solution) through a
+    // memory mapping, keeping the resident set bounded
+    static bool exportMazeFile(const std::string& mazePath,
+                               const std::string& outputPath, int pixelsPerCell = 1);
+};
+
+#endif // IMAGE_EXPORTER_H
@@ -0,0 +1,288 @@
+#include "Leaderboard.h"
+#include <algorithm>
+
+/**
+ * Constructor: Empty board
+ */
+Leaderboard::Leaderboard() : root(-1), rngState(0x9E3779B9u) {
+}
+
+/**
+ * Ordering: higher score first, ties broken by name
+ */
+bool Leaderboard::ranksAbove(int scoreA, const std::string& nameA, int scoreB, const std::string& nameB) {
+    if (scoreA != scoreB) {
+        return scoreA > scoreB;
+    }
+    return nameA < nameB;
+}
+
+/**
+ * Get subtree size (0 for none)
+ */
+int Leaderboard::sizeOf(int node) const {
+    return node < 0 ? 0 : nodes[node].size;
+}
+
+/**
+ * Recompute a node's subtree size from its children
+ */
+void Leaderboard::update(int node) {
+    nodes[node].size = 1 + sizeOf(nodes[node].left) + sizeOf(nodes[node].right);
+}
+
+/**
+ * Next random heap priority (xorshift32)
+ */
+uint32_t Leaderboard::nextPriority() {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return rngState;
+}
+
+/**
+ * Take a node from the free list or grow the arena
+ */
+int Leaderboard::allocate(const std::string& name, int score) {
+    int index;
+    if (!freeList.empty()) {
+        index = freeList.back();
+        freeList.pop_back();
+    } else {
+        index = (int)nodes.size();
+        nodes.emplace_back();
+    }
+
+    Node& node = nodes[index];
+    node.name = name;
+    node.score = score;
+    node.priority = nextPriority();
+    node.size = 1;
+    node.left = node.right = -1;
+    return index;
+}
+
+/**
+ * Split a subtree into nodes ranked above (score, name) and the rest
+ */
+void Leaderboard::split(int node, int score, const std::string& name, int& less, int& rest) {
+    if (node < 0) {
+        less = rest = -1;
+        return;
+    }
+
+    if (ranksAbove(nodes[node].score, nodes[node].name, score, name)) {
+        split(nodes[node].right, score, name, nodes[node].right, rest);
+        less = node;
+    } else {
+        split(nodes[node].left, score, name, less, nodes[node].left);
+        rest = node;
+    }
+    update(node);
+}
+
+/**
+ * Join two subtrees where every node of a ranks above every node of b
+ */
+int Leaderboard::merge(int a, int b) {
+    if (a < 0) return b;
+    if (b < 0) return a;
+
+    if (nodes[a].priority > nodes[b].priority) {
+        nodes[a].right = merge(nodes[a].right, b);
+        update(a);
+        return a;
+    }
+    nodes[b].left = merge(a, nodes[b].left);
+    update(b);
+    return b;
+}
+
+/**
+ * Insert a fresh node, rotating it up by splitting where its priority wins
+ */
+int Leaderboard::insertNode(int node, int fresh) {
+    if (node < 0) {
+        return fresh;
+    }
+
+    if (nodes[fresh].priority > nodes[node].priority) {
+        split(node, nodes[fresh].score, nodes[fresh].name, nodes[fresh].left, nodes[fresh].right);
+        update(fresh);
+        return fresh;
+    }
+
+    if (ranksAbove(nodes[fresh].score, nodes[fresh].name, nodes[node].score, nodes[node].name)) {
+        nodes[node].left = insertNode(nodes[node].left, fresh);
+    } else {
+        nodes[node].right = insertNode(nodes[node].right, fresh);
+    }
+    update(node);
+    return node;
+}
+
+/**
+ * Remove the node with key (score, name) from a subtree
+ */
+int Leaderboard::eraseNode(int node, int score, const std::string& name) {
+    if (node < 0) {
+        return -1;
+    }
+
+    if (nodes[node].score == score && nodes[node].name == name) {
+        int joined = merge(nodes[node].left, nodes[node].right);
+        freeList.push_back(node);
+        return joined;
+    }
+
+    if (ranksAbove(score, name, nodes[node].score, nodes[node].name)) {
+        nodes[node].left = eraseNode(nodes[node].left, score, name);
+    } else {
+        nodes[node].right = eraseNode(nodes[node].right, score, name);
+    }
+    update(node);
+    return node;
+}
+
+/**
+ * Record a score, keeping the player's best
+ */
+bool Leaderboard::submit(const std::string& playerName, int score) {
+    auto it = nodeOf.find(playerName);
+    if (it != nodeOf.end()) {
+        if (score <= nodes[it->second].score) {
+            return false;
+        }
+        root = eraseNode(root, nodes[it->second].score, playerName);
+    }
+
+    int fresh = allocate(playerName, score);
+    root = insertNode(root, fresh);
+    nodeOf[playerName] = fresh;
+    return true;
+}
+
+/**
+ * Remove a player from the board
+ */
+bool Leaderboard::remove(const std::string& playerName) {
+    auto it = nodeOf.find(playerName);
+    if (it == nodeOf.end()) {
+        return false;
+    }
+
+    root = eraseNode(root, nodes[it->second].score, playerName);
+    nodeOf.erase(it);
+    return true;
+}
+
+/**
+ * Get 1-based rank of a player
+ */
+int Leaderboard::getRank(const std::string& playerName) const {
+    auto it = nodeOf.find(playerName);
+    if (it == nodeOf.end()) {
+        return 0;
+    }
+    return countAbove(nodes[it->second].score, playerName) + 1;
+}
+
+/**
+ * Count players ranked above a key by walking down from the root,
+ * adding up left subtrees whenever the walk turns right
+ */
+int Leaderboard::countAbove(int score, const std::string& playerName) const {
+    int above = 0;
+    int node = root;
+    while (node >= 0) {
+        const Node& current = nodes[node];
+        if (ranksAbove(current.score, current.name, score, playerName)) {
+            above += sizeOf(current.left) + 1;
+            node = current.right;
+        } else {
+            node = current.left;
+        }
+    }
+    return above;
+}
+
+/**
+ * Get a player's best score
+ */
+bool Leaderboard::getScore(const std::string& playerName, int& score) const {
+    auto it = nodeOf.find(playerName);
+    if (it == nodeOf.end()) {
+        return false;
+    }
+    score = nodes[it->second].score;
+    return true;
+}
+
+/**
+ * Get the best k entries with an in-order walk that stops after k nodes
+ */
+std::vector<std::pair<std::string, int>> Leaderboard::top(int count) const {
+    std::vector<std::pair<std::string, int>> entries;
+    if (count <= 0) {
+        return entries;
+    }
+    entries.reserve(std::min((size_t)count, nodeOf.size()));
+
+    std::vector<int> stack;
+    int node = root;
+    while ((node >= 0 || !stack.empty()) && (int)entries.size() < count) {
+        while (node >= 0) {
+            stack.push_back(node);
+            node = nodes[node].left;
+        }
+        node = stack.back();
+        stack.pop_back();
+        entries.push_back(std::make_pair(nodes[node].name, nodes[node].score));
+        node = nodes[node].right;
+    }
+
+    return entries;
+}
+
+/**
+ * Get entry at a 1-based rank by descending on subtree sizes
+ */
+bool Leaderboard::entryAt(int rank, std::pair<std::string, int>& entry) const {
+    if (rank < 1 || rank > sizeOf(root)) {
+        return false;
+    }
+
+    int node = root;
+    while (node >= 0) {
+        int leftSize = sizeOf(nodes[node].left);
+        if (rank == leftSize + 1) {
+            entry = std::make_pair(nodes[node].name, nodes[node].score);
+            return true;
+        }
+        if (rank <= leftSize) {
+            node = nodes[node].left;
+        } else {
+            rank -= leftSize + 1;
+            node = nodes[node].right;
+        }
+    }
+    return false;
+}
+
+/**
+ * Get number of players
+ */
+size_t Leaderboard::size() const {
+    return nodeOf.size();
+}
+
+/**
+ * Remove everyone
+ */
+void Leaderboard::clear() {
+    nodes.clear();
+    freeList.clear();
+    nodeOf.clear();
+    root = -1;
+}
@@ -0,0 +1,80 @@
+#ifndef LEADERBOARD_H
+#define LEADERBOARD_H
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <utility>
+#include <cstdint>
+
+/**
+ * Leaderboard class
+ * Ranked index of each player's best score, kept as an order-statistic
+ * treap ordered by (score descending, name ascending). Every node stores
+ * its subtree size, so insert/update, remove and "rank of player X" are
+ * O(log n), and the top k come from an in-order walk in O(k + log n)
+ * Nodes live in one arena vector (indices instead of pointers, freed slots
+ * reused) and a HashMap finds a player's node by name
+ * Member: 4 - Scoring system
+ */
+class Leaderboard {
+private:
+    struct Node {
+        std::string name;
+        int score;
+        uint32_t priority;      // Heap order keeps the tree balanced in expectation
+        int size;               // Nodes in this subtree
+        int left, right;        // Arena indices, -1 = none
+    };
+
+    std::vector<Node> nodes;                        // Arena
+    std::vector<int> freeList;                      // Reusable arena slots
+    std::unordered_map<std::string, int> nodeOf;    // Player name -> node
+    int root;
+    uint32_t rngState;
+
+    // Helper functions
+    static bool ranksAbove(int scoreA, const std::string& nameA, int scoreB, const std::string& nameB);
+    int sizeOf(int node) const;
+    void update(int node);
+    uint32_t nextPriority();
+    int allocate(const std::string& name, int score);
+    void split(int node, int score, const std::string& name, int& less, int& rest);
+    int merge(int a, int b);
+    int insertNode(int node, int fresh);
+    int eraseNode(int node, int score, const std::string& name);
+
+public:
+    // Constructor
+    Leaderboard();
+
+    // Record a score, keeping each player's best
+    // Returns true if the board changed (new player or higher score)
+    bool submit(const std::string& playerName, int score);
+
+    // Remove a player, returns false if unknown
+    bool remove(const std::string& playerName);
+
+    // 1-based rank of a player, 0 if unknown
+    int getRank(const std::string& playerName) const;
+
+    // Number of players ranked above (score, name), O(log n)
+    int countAbove(int score, const std::string& playerName) const;
+
+    // Best score of a player, returns false if unknown
+    bool getScore(const std::string& playerName, int& score) const;
+
+    // Best k entries, highest score first (ties by name)
+    std::vector<std::pair<std::string, int>> top(int count) const;
+
+    // Entry at a 1-based rank
+    bool entryAt(int rank, std::pair<std::string, int>& entry) const;
+
+    // Number of players
+    size_t size() const;
+
+    // Remove everyone
+    void clear();
+};
+
+#endif // LEADERBOARD_H
@@ -0,0 +1,261 @@
+#include "LeaderboardFile.h"
+#include <cstring>
+#include <algorithm>
+#include <numeric>
+#include <unordered_map>
+
+namespace {
+
+const char MAGIC[8] = {'M', 'Z', 'L', 'B', '0', '0', '0', '1'};
+
+/**
+ * Ordering: higher score first, ties broken by name
+ */
+bool ranksAbove(int scoreA, std::string_view nameA, int scoreB, std::string_view nameB) {
+    if (scoreA != scoreB) {
+        return scoreA > scoreB;
+    }
+    return nameA < nameB;
+}
+
+} // namespace
+
+/**
+ * Constructor: Empty board
+ */
+LeaderboardFile::LeaderboardFile()
+    : records(nullptr), nameIndex(nullptr), names(nullptr), namesBytes(0), count(0) {
+}
+
+/**
+ * Map a snapshot and check its header: every section must lie inside the
+ * file; records and index entries are checked as they are read
+ */
+bool LeaderboardFile::open(const std::string& path) {
+    close();
+
+    if (!file.openReadOnly(path) || file.size() < sizeof(Header)) {
+        close();
+        return false;
+    }
+
+    Header header;
+    std::memcpy(&header, file.data(), sizeof(Header));
+
+    // Section checks are written so that no sum can overflow
+    uint64_t size = file.size();
+    bool valid = std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) == 0 &&
+                 header.count <= size / sizeof(Record) &&
+                 header.recordsOffset % alignof(Record) == 0 &&
+                 header.recordsOffset <= size &&
+                 header.count <= (size - header.recordsOffset) / sizeof(Record) &&
+                 header.indexOffset % alignof(uint32_t) == 0 &&
+                 header.indexOffset <= size &&
+                 header.count <= (size - header.indexOffset) / sizeof(uint32_t) &&
+                 header.namesOffset <= size &&
+                 header.namesBytes <= size - header.namesOffset;
+    if (!valid) {
+        close();
+        return false;
+    }
+
+    records = reinterpret_cast<const Record*>(file.data() + header.recordsOffset);
+    nameIndex = reinterpret_cast<const uint32_t*>(file.data() + header.indexOffset);
+    names = file.data() + header.namesOffset;
+    namesBytes = header.namesBytes;
+    count = (size_t)header.count;
+
+    file.adviseRandom();
+    return true;
+}
+
+/**
+ * Unmap the snapshot
+ */
+void LeaderboardFile::close() {
+    file.close();
+    records = nullptr;
+    nameIndex = nullptr;
+    names = nullptr;
+    namesBytes = 0;
+    count = 0;
+}
+
+/**
+ * Check if a snapshot is mapped
+ */
+bool LeaderboardFile::isOpen() const {
+    return file.isOpen();
+}
+
+/**
+ * Get number of stored players
+ */
+size_t LeaderboardFile::size() const {
+    return count;
+}
+
+/**
+ * View of a record's name inside the mapping
+ * A name range outside the names section (corrupt file) reads as empty
+ */
+std::string_view LeaderboardFile::nameOf(const Record& record) const {
+    if (record.nameOffset > namesBytes || record.nameLength > namesBytes - record.nameOffset) {
+        return std::string_view();
+    }
+    return std::string_view(names + record.nameOffset, record.nameLength);
+}
+
+/**
+ * Get name at a 0-based rank
+ */
+std::string LeaderboardFile::nameAt(size_t index) const {
+    return std::string(nameOf(records[index]));
+}
+
+/**
+ * Get score at a 0-based rank
+ */
+int LeaderboardFile::scoreAt(size_t index) const {
+    return records[index].score;
+}
+
+/**
+ * Find a player by binary search over the name index
+ * An index entry that isn't a record number (corrupt file) ends the search
+ */
+bool LeaderboardFile::find(const std::string& playerName, size_t& index) const {
+    std::string_view key(playerName);
+    size_t low = 0;
+    size_t high = count;
+
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (nameIndex[mid] >= count) {
+            return false;
+        }
+        std::string_view name = nameOf(records[nameIndex[mid]]);
+        if (name < key) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+
+    if (low < count && nameIndex[low] < count && nameOf(records[nameIndex[low]]) == key) {
+        index = nameIndex[low];
+        return true;
+    }
+    return false;
+}
+
+/**
+ * Count records ranked above (score, name) by binary search
+ */
+size_t LeaderboardFile::countAbove(int score, const std::string& playerName) const {
+    size_t low = 0;
+    size_t high = count;
+
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (ranksAbove(records[mid].score, nameOf(records[mid]), score, playerName)) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+/**
+ * Merge a snapshot with updates into one sorted board
+ * Updates that don't beat the stored score are dropped, the others
+ * replace the stored record of that player
+ */
+std::vector<LeaderboardFile::Entry> LeaderboardFile::merge(const LeaderboardFile& base,
+                                                          const std::vector<Entry>& updates) {
+    std::unordered_map<std::string, int> best;
+    for (const Entry& update : updates) {
+        auto it = best.find(update.first);
+        if (it == best.end() || update.second > it->second) {
+            best[update.first] = update.second;
+        }
+    }
+
+    std::vector<Entry> changed;
+    for (auto it = best.begin(); it != best.end();) {
+        size_t index;
+        if (base.find(it->first, index) && base.scoreAt(index) >= it->second) {
+            it = best.erase(it);
+        } else {
+            changed.push_back(*it);
+            ++it;
+        }
+    }
+
+    std::sort(changed.begin(), changed.end(), [](const Entry& a, const Entry& b) {
+        return ranksAbove(a.second, a.first, b.second, b.first);
+    });
+
+    std::vector<Entry> merged;
+    merged.reserve(base.size() + changed.size());
+
+    size_t i = 0;
+    size_t j = 0;
+    while (i < base.size() || j < changed.size()) {
+        if (i < base.size()) {
+            std::string name = base.nameAt(i);
+            if (best.count(name)) {
+                i++;
+                continue;
+            }
+            if (j == changed.size() ||
+                ranksAbove(base.scoreAt(i), name, changed[j].second, changed[j].first)) {
+                merged.push_back(std::make_pair(std::move(name), base.scoreAt(i)));
+                i++;
+                continue;
+            }
+        }
+        merged.push_back(changed[j++]);
+    }
+
+    return merged;
+}
+
+/**
+ * Write a sorted board in snapshot format
+ */
+bool LeaderboardFile::write(std::FILE* out, const std::vector<Entry>& sortedEntries) {
+    size_t total = sortedEntries.size();
+
+    Header header;
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.count = total;
+    header.recordsOffset = sizeof(Header);
+    header.indexOffset = header.recordsOffset + total * sizeof(Record);
+    header.namesOffset = header.indexOffset + total * sizeof(uint32_t);
+    header.namesBytes = 0;
+
+    std::vector<Record> recordTable(total);
+    for (size_t i = 0; i < total; i++) {
+        recordTable[i].score = sortedEntries[i].second;
+        recordTable[i].nameLength = (uint32_t)sortedEntries[i].first.size();
+        recordTable[i].nameOffset = header.namesBytes;
+        header.namesBytes += sortedEntries[i].first.size();
+    }
+
+    std::vector<uint32_t> index(total);
+    std::iota(index.begin(), index.end(), 0);
+    std::sort(index.begin(), index.end(), [&sortedEntries](uint32_t a, uint32_t b) {
+        return sortedEntries[a].first < sortedEntries[b].first;
+    });
+
+    bool ok = std::fwrite(&header, sizeof(Header), 1, out) == 1;
+    ok = ok && std::fwrite(recordTable.data(), sizeof(Record), total, out) == total;
+    ok = ok && std::fwrite(index.data(), sizeof(uint32_t), total, out) == total;
+    for (size_t i = 0; ok && i < total; i++) {
+        const std::string& name = sortedEntries[i].first;
+        ok = std::fwrite(name.data(), 1, name.size(), out) == name.size();
+    }
+    return ok;
+}
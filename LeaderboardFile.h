@@ -0,0 +1,89 @@
+#ifndef LEADERBOARD_FILE_H
+#define LEADERBOARD_FILE_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <utility>
+#include <cstdio>
+#include <cstdint>
+#include "MappedFile.h"
+
+/**
+ * LeaderboardFile class
+ * Read-only view of the binary leaderboard snapshot (highscores.bin),
+ * memory-mapped so opening it costs O(1) however many scores it holds
+ * Only the header is checked on open; each record's name range and each
+ * index entry is checked when it is read, so a corrupt file never reads
+ * outside the mapping (a bad name reads as empty, a bad index entry ends
+ * the lookup)
+ * Layout (native byte order):
+ *   header   "MZLB0001", count, section offsets
+ *   records  count x {score, name length, name offset}, sorted by
+ *            (score descending, name ascending) - record i is rank i + 1
+ *   index    count x record number, sorted by name
+ *   names    packed name bytes
+ * The top k only touch the first k records, a name lookup is a binary
+ * search over the index, and a rank is a binary search over the records
+ * Member: 4 - Scoring system
+ */
+class LeaderboardFile {
+public:
+    typedef std::pair<std::string, int> Entry;
+
+private:
+    struct Header {
+        char magic[8];
+        uint64_t count;
+        uint64_t recordsOffset;
+        uint64_t indexOffset;
+        uint64_t namesOffset;
+        uint64_t namesBytes;
+    };
+
+    struct Record {
+        int32_t score;
+        uint32_t nameLength;
+        uint64_t nameOffset;
+    };
+
+    MappedFile file;
+    const Record* records;
+    const uint32_t* nameIndex;
+    const char* names;
+    uint64_t namesBytes;
+    size_t count;
+
+    std::string_view nameOf(const Record& record) const;
+
+public:
+    // Constructor
+    LeaderboardFile();
+
+    // Map a snapshot, returns false if missing or malformed (board is then empty)
+    bool open(const std::string& path);
+    void close();
+    bool isOpen() const;
+
+    // Number of stored players
+    size_t size() const;
+
+    // Entry at a 0-based rank
+    std::string nameAt(size_t index) const;
+    int scoreAt(size_t index) const;
+
+    // Find a player by name, returns false if not stored
+    bool find(const std::string& playerName, size_t& index) const;
+
+    // Number of stored players ranked above (score, name)
+    size_t countAbove(int score, const std::string& playerName) const;
+
+    // Full board after applying updates (best score per player wins)
+    // base may be closed (empty); updates may be in any order
+    static std::vector<Entry> merge(const LeaderboardFile& base, const std::vector<Entry>& updates);
+
+    // Write a board sorted by (score desc, name asc) in snapshot format
+    static bool write(std::FILE* out, const std::vector<Entry>& sortedEntries);
+};
+
+#endif // LEADERBOARD_FILE_H
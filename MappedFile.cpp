@@ -0,0 +1,185 @@
+#include "MappedFile.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+/**
+ * Constructor: Initialize an empty mapping
+ */
+MappedFile::MappedFile() : fd(-1), mapping(nullptr), length(0), writable(false) {
+}
+
+/**
+ * Destructor: Unmap and close the file
+ */
+MappedFile::~MappedFile() {
+    close();
+}
+
+/**
+ * Map an existing file read-only
+ * Windows builds fall back to reporting failure (no mmap)
+ */
+bool MappedFile::openReadOnly(const std::string& path) {
+    close();
+#ifdef _WIN32
+    (void)path;
+    return false;
+#else
+    fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size == 0) {
+        close();
+        return false;
+    }
+
+    length = (size_t)info.st_size;
+    void* ptr = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+    if (ptr == MAP_FAILED) {
+        close();
+        return false;
+    }
+
+    mapping = static_cast<char*>(ptr);
+    writable = false;
+    return true;
+#endif
+}
+
+/**
+ * Create (or truncate) a file and map it read-write
+ */
+bool MappedFile::createReadWrite(const std::string& path, size_t size) {
+    close();
+#ifdef _WIN32
+    (void)path;
+    (void)size;
+    return false;
+#else
+    if (size == 0) {
+        return false;
+    }
+
+    fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        return false;
+    }
+
+    // ftruncate leaves the file sparse: untouched pages cost no disk or RAM
+    if (ftruncate(fd, (off_t)size) != 0) {
+        close();
+        return false;
+    }
+
+    length = size;
+    void* ptr = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (ptr == MAP_FAILED) {
+        close();
+        return false;
+    }
+
+    mapping = static_cast<char*>(ptr);
+    writable = true;
+    return true;
+#endif
+}
+
+/**
+ * Unmap and close
+ */
+void MappedFile::close() {
+#ifndef _WIN32
+    if (mapping != nullptr) {
+        munmap(mapping, length);
+    }
+    if (fd >= 0) {
+        ::close(fd);
+    }
+#endif
+    mapping = nullptr;
+    fd = -1;
+    length = 0;
+    writable = false;
+}
+
+/**
+ * Get read-only pointer to the mapped bytes
+ */
+const char* MappedFile::data() const {
+    return mapping;
+}
+
+/**
+ * Get writable pointer (nullptr for read-only mappings)
+ */
+char* MappedFile::mutableData() {
+    return writable ? mapping : nullptr;
+}
+
+/**
+ * Get mapped size in bytes
+ */
+size_t MappedFile::size() const {
+    return length;
+}
+
+/**
+ * Check if a file is mapped
+ */
+bool MappedFile::isOpen() const {
+    return mapping != nullptr;
+}
+
+/**
+ * Hint sequential access (aggressive read-ahead)
+ */
+void MappedFile::adviseSequential() {
+#ifndef _WIN32
+    if (mapping != nullptr) {
+        madvise(mapping, length, MADV_SEQUENTIAL);
+    }
+#endif
+}
+
+/**
+ * Hint random access (no read-ahead)
+ */
+void MappedFile::adviseRandom() {
+#ifndef _WIN32
+    if (mapping != nullptr) {
+        madvise(mapping, length, MADV_RANDOM);
+    }
+#endif
+}
+
+/**
+ * Drop resident pages of this mapping
+ * Safe for shared file mappings: dirty pages are already in the page cache
+ */
+void MappedFile::releaseResidentPages() {
+#ifndef _WIN32
+    if (mapping != nullptr) {
+        madvise(mapping, length, MADV_DONTNEED);
+    }
+#endif
+}
+
+/**
+ * Get system page size
+ */
+size_t MappedFile::pageSize() {
+#ifdef _WIN32
+    return 4096;
+#else
+    static const size_t size = (size_t)sysconf(_SC_PAGESIZE);
+    return size;
+#endif
+}
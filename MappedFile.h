@@ -0,0 +1,58 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <string>
+#include <cstddef>
+
+/**
+ * MappedFile class
+ * RAII wrapper around a memory-mapped file (mmap on POSIX)
+ * Lets solvers and loaders work on files larger than RAM: the kernel pages
+ * data in on demand and may drop clean pages under memory pressure
+ * Member: 6 - Utility + Display
+ */
+class MappedFile {
+private:
+    int fd;
+    char* mapping;
+    size_t length;
+    bool writable;
+
+public:
+    // Constructor / Destructor
+    MappedFile();
+    ~MappedFile();
+
+    // Mappings own a file descriptor, so they are not copyable
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // Map an existing file read-only
+    bool openReadOnly(const std::string& path);
+
+    // Create (or truncate) a file of the given size and map it read-write
+    // The file starts sparse and zero-filled
+    bool createReadWrite(const std::string& path, size_t size);
+
+    // Unmap and close
+    void close();
+
+    // Access mapped bytes
+    const char* data() const;
+    char* mutableData();
+    size_t size() const;
+    bool isOpen() const;
+
+    // Access pattern hints (no-ops where unsupported)
+    void adviseSequential();
+    void adviseRandom();
+
+    // Drop this process's resident pages; data stays in the file/page cache
+    // and is faulted back in on the next access
+    void releaseResidentPages();
+
+    // Page size used for accounting
+    static size_t pageSize();
+};
+
+#endif // MAPPED_FILE_H
@@ -1,12 +1,66 @@
 #include "MazeGenerator.h"
+#include "MappedFile.h"
 #include <iostream>
 #include <random>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+// Text written per block by saveToFile()/printMaze()
+const size_t WRITE_BLOCK_BYTES = 1 << 20;
+
+// Mapped rows between page releases while loading
+const int RELEASE_INTERVAL = 4096;
+
+// Byte-lane constants for scanning 8 characters per 64-bit word
+const uint64_t LANE_ONES = 0x0101010101010101ULL;
+const uint64_t LANE_HIGH = 0x80 * LANE_ONES;
+const uint64_t LANE_LOW7 = 0x7F * LANE_ONES;
+
+/**
+ * 0x80 in every byte of word equal to glyph, 0 in every other byte
+ * (exact: the per-byte additions never carry into the next byte)
+ */
+inline uint64_t matchBytes(uint64_t word, char glyph) {
+    uint64_t x = word ^ ((unsigned char)glyph * LANE_ONES);
+    return ~(((x & LANE_LOW7) + LANE_LOW7) | x | LANE_LOW7);
+}
+
+/**
+ * Check that a row holds only '#', ' ', 'S' and 'E', eight bytes per step
+ * with no data-dependent branches; hasEndpoint reports any 'S' or 'E'
+ */
+bool scanRow(const char* row, size_t width, bool& hasEndpoint) {
+    uint64_t bad = 0;
+    uint64_t endpoints = 0;
+    size_t x = 0;
+    for (; x + 8 <= width; x += 8) {
+        uint64_t word;
+        std::memcpy(&word, row + x, 8);
+        uint64_t ends = matchBytes(word, 'S') | matchBytes(word, 'E');
+        uint64_t known = matchBytes(word, '#') | matchBytes(word, ' ') | ends;
+        bad |= known ^ LANE_HIGH;
+        endpoints |= ends;
+    }
+    for (; x < width; x++) {
+        char c = row[x];
+        bool end = (c == 'S') | (c == 'E');
+        bad |= !(end | (c == '#') | (c == ' '));
+        endpoints |= end;
+    }
+    
+    hasEndpoint = endpoints != 0;
+    return bad == 0;
+}
+
+} // namespace
 
 /**
  * Constructor: Initialize maze with given dimensions
  * Ensures dimensions are odd numbers for proper maze structure
  */
-MazeGenerator::MazeGenerator(int width, int height) {
+MazeGenerator::MazeGenerator(int width, int height) : seed(0) {
     // Ensure dimensions are odd
     this->width = (width % 2 == 0) ? width + 1 : width;
     this->height = (height % 2 == 0) ? height + 1 : height;
@@ -14,6 +68,14 @@ MazeGenerator::MazeGenerator(int width, int height) {
     // Initialize maze with all walls
     maze.resize(this->height, std::vector<char>(this->width, '#'));
     visited.resize(this->height, std::vector<bool>(this->width, false));
+    
+    passableStride = this->width + 2;
+    passable.assign((size_t)passableStride * (this->height + 2), 0);
+    
+    startX = 1;
+    startY = 1;
+    exitX = this->width - 2;
+    exitY = this->height - 2;
 }
 
 /**
@@ -60,11 +122,21 @@ void MazeGenerator::removeWall(int x1, int y1, int x2, int y2) {
     maze[midY][midX] = ' ';
 }
 
+/**
+ * Generate maze with a fresh random seed
+ */
+void MazeGenerator::generateMaze() {
+    std::random_device rd;
+    generateMaze(rd());
+}
+
 /**
  * Generate maze using Depth First Search (DFS) algorithm
  * Uses Stack data structure for backtracking
  */
-void MazeGenerator::generateMaze() {
+void MazeGenerator::generateMaze(uint32_t seed) {
+    this->seed = seed;
+    
     // Clear previous maze
     for (int i = 0; i < height; i++) {
         for (int j = 0; j < width; j++) {
@@ -73,9 +145,8 @@ void MazeGenerator::generateMaze() {
         }
     }
     
-    // Random number generator
-    std::random_device rd;
-    std::mt19937 gen(rd());
+    // Random number generator (seeded, so a maze can be regenerated)
+    std::mt19937 gen(seed);
     
     // Stack for DFS backtracking
     std::stack<Cell> cellStack;
@@ -118,6 +189,33 @@ void MazeGenerator::generateMaze() {
     // Set start and exit positions
     setStartPosition(1, 1);
     setExitPosition(width - 2, height - 2);
+    
+    rebuildPassability();
+}
+
+/**
+ * Get seed of the last generated maze
+ */
+uint32_t MazeGenerator::getSeed() const {
+    return seed;
+}
+
+/**
+ * Rebuild the padded passability bitmap from the maze grid
+ */
+void MazeGenerator::rebuildPassability() {
+    std::fill(passable.begin(), passable.end(), 0);
+    for (int y = 0; y < height; y++) {
+        unsigned char* row = &passable[getPassabilityIndex(0, y)];
+        const char* cells = maze[y].data();
+        
+        // Same cell set as isValidPath(), written branch-free so it vectorizes
+        for (int x = 0; x < width; x++) {
+            char c = cells[x];
+            row[x] = (unsigned char)((c == ' ') | (c == 'S') | (c == 'E') |
+                                     (c == 'P') | (c == '*') | (c == 'B'));
+        }
+    }
 }
 
 /**
@@ -126,6 +224,8 @@ void MazeGenerator::generateMaze() {
 void MazeGenerator::setStartPosition(int x, int y) {
     if (isValidCell(x, y) && maze[y][x] == ' ') {
         maze[y][x] = 'S';
+        startX = x;
+        startY = y;
     }
 }
 
@@ -135,6 +235,8 @@ void MazeGenerator::setStartPosition(int x, int y) {
 void MazeGenerator::setExitPosition(int x, int y) {
     if (isValidCell(x, y) && maze[y][x] == ' ') {
         maze[y][x] = 'E';
+        exitX = x;
+        exitY = y;
     }
 }
 
@@ -147,6 +249,52 @@ bool MazeGenerator::isValidPath(int x, int y) const {
     return cell == ' ' || cell == 'S' || cell == 'E' || cell == 'P' || cell == '*' || cell == 'B';
 }
 
+/**
+ * Check if a cell may be edited during play
+ * The outer border stays solid and start/exit are never touched
+ */
+bool MazeGenerator::isEditable(int x, int y) const {
+    if (x <= 0 || x >= width - 1 || y <= 0 || y >= height - 1) return false;
+    char cell = maze[y][x];
+    return cell != 'S' && cell != 'E';
+}
+
+/**
+ * Open or close a single cell (dynamic maze mode)
+ * Returns true if the cell changed, so callers only notify planners on real edits
+ */
+bool MazeGenerator::setWall(int x, int y, bool wall) {
+    if (!isEditable(x, y)) return false;
+    
+    char newCell = wall ? '#' : ' ';
+    if (maze[y][x] == newCell) return false;
+    
+    maze[y][x] = newCell;
+    passable[getPassabilityIndex(x, y)] = wall ? 0 : 1;
+    return true;
+}
+
+/**
+ * Get padded passability bitmap
+ */
+const unsigned char* MazeGenerator::getPassabilityGrid() const {
+    return passable.data();
+}
+
+/**
+ * Get row stride of the passability bitmap (width + 2)
+ */
+int MazeGenerator::getPassabilityStride() const {
+    return passableStride;
+}
+
+/**
+ * Get bitmap index of cell (x, y)
+ */
+int MazeGenerator::getPassabilityIndex(int x, int y) const {
+    return (y + 1) * passableStride + (x + 1);
+}
+
 /**
  * Get maze representation
  */
@@ -154,6 +302,13 @@ std::vector<std::vector<char>> MazeGenerator::getMaze() const {
     return maze;
 }
 
+/**
+ * Get one cell's character
+ */
+char MazeGenerator::getCell(int x, int y) const {
+    return maze[y][x];
+}
+
 /**
  * Get maze width
  */
@@ -172,25 +327,174 @@ int MazeGenerator::getHeight() const {
  * Get start position
  */
 std::pair<int, int> MazeGenerator::getStartPosition() const {
-    return std::make_pair(1, 1);
+    return std::make_pair(startX, startY);
 }
 
 /**
  * Get exit position
  */
 std::pair<int, int> MazeGenerator::getExitPosition() const {
-    return std::make_pair(width - 2, height - 2);
+    return std::make_pair(exitX, exitY);
 }
 
 /**
  * Print maze (for debugging)
  */
 void MazeGenerator::printMaze() const {
-    for (int i = 0; i < height; i++) {
-        for (int j = 0; j < width; j++) {
-            std::cout << maze[i][j];
+    std::vector<char> block;
+    int rowsPerBlock = std::max(1, (int)(WRITE_BLOCK_BYTES / (width + 1)));
+    for (int y = 0; y < height; y += rowsPerBlock) {
+        size_t bytes = formatRows(y, std::min(rowsPerBlock, height - y), block);
+        std::cout.write(block.data(), bytes);
+    }
+    std::cout.flush();
+}
+
+/**
+ * Format rows [firstRow, firstRow + rowCount) as text lines into block
+ * Returns the number of bytes used
+ */
+size_t MazeGenerator::formatRows(int firstRow, int rowCount, std::vector<char>& block) const {
+    size_t lineBytes = (size_t)width + 1;
+    block.resize(lineBytes * rowCount);
+    
+    char* out = block.data();
+    for (int y = firstRow; y < firstRow + rowCount; y++) {
+        std::memcpy(out, maze[y].data(), width);
+        out[width] = '\n';
+        out += lineBytes;
+    }
+    return lineBytes * rowCount;
+}
+
+/**
+ * Write the maze as text, one large block of rows at a time
+ */
+bool MazeGenerator::saveToFile(const std::string& path) const {
+    FILE* out = std::fopen(path.c_str(), "wb");
+    if (out == nullptr) {
+        return false;
+    }
+    
+    // Blocks are already large, stdio buffering would only add a copy
+    std::setvbuf(out, nullptr, _IONBF, 0);
+    
+    std::vector<char> block;
+    int rowsPerBlock = std::max(1, (int)(WRITE_BLOCK_BYTES / (width + 1)));
+    bool ok = true;
+    for (int y = 0; y < height && ok; y += rowsPerBlock) {
+        size_t bytes = formatRows(y, std::min(rowsPerBlock, height - y), block);
+        ok = std::fwrite(block.data(), 1, bytes, out) == bytes;
+    }
+    
+    if (std::fclose(out) != 0) {
+        ok = false;
+    }
+    return ok;
+}
+
+/**
+ * Load a maze text file through a read-only mapping
+ * Width is the length of the first line; every row must have that length
+ * and hold only '#', ' ', 'S' and 'E', with exactly one 'S' and one 'E'.
+ * Each row is checked a 64-bit word at a time (scanRow), the start and
+ * exit are located with memchr only in rows that have them
+ */
+bool MazeGenerator::loadFromFile(const std::string& path) {
+    MappedFile file;
+    if (!file.openReadOnly(path)) {
+        return false;
+    }
+    
+    const char* data = file.data();
+    size_t size = file.size();
+    const char* newline = static_cast<const char*>(std::memchr(data, '\n', size));
+    if (newline == nullptr) {
+        return false;
+    }
+    
+    // Geometry from the first line: "\r\n" endings just widen the stride
+    size_t rowStride = (size_t)(newline - data) + 1;
+    size_t lineEnd = (rowStride >= 2 && newline[-1] == '\r') ? 2 : 1;
+    size_t rowWidth = rowStride - lineEnd;
+    
+    // Last row may be missing its line ending, nothing else may be left over
+    size_t rows = size / rowStride;
+    size_t leftover = size % rowStride;
+    if (leftover == rowWidth) {
+        rows++;
+    } else if (leftover != 0) {
+        return false;
+    }
+    if (rowWidth < 3 || rows < 3 || rowWidth > 0x7FFFFFFF || rows > 0x7FFFFFFF) {
+        return false;
+    }
+    
+    int newWidth = (int)rowWidth;
+    int newHeight = (int)rows;
+    std::vector<std::vector<char>> cells(newHeight);
+    long long starts = 0;
+    long long exits = 0;
+    int newStartX = -1, newStartY = -1;
+    int newExitX = -1, newExitY = -1;
+    
+    file.adviseSequential();
+    for (int y = 0; y < newHeight; y++) {
+        const char* row = data + (size_t)y * rowStride;
+        
+        // Line ending in place (the last row may have none)
+        if ((size_t)y * rowStride + rowStride <= size) {
+            if (row[rowWidth + lineEnd - 1] != '\n' || (lineEnd == 2 && row[rowWidth] != '\r')) {
+                return false;
+            }
+        }
+        
+        bool endpoint;
+        if (!scanRow(row, rowWidth, endpoint)) {
+            return false;
         }
-        std::cout << std::endl;
+        
+        // Rare rows with markers: locate (and count) them with memchr
+        if (endpoint) {
+            for (const char* s = row; (s = static_cast<const char*>(
+                     std::memchr(s, 'S', rowWidth - (s - row)))) != nullptr; s++) {
+                newStartX = (int)(s - row);
+                newStartY = y;
+                starts++;
+            }
+            for (const char* e = row; (e = static_cast<const char*>(
+                     std::memchr(e, 'E', rowWidth - (e - row)))) != nullptr; e++) {
+                newExitX = (int)(e - row);
+                newExitY = y;
+                exits++;
+            }
+        }
+        
+        cells[y].assign(row, row + rowWidth);
+        
+        // Rows are copied out, so mapped pages need not stay resident
+        if (y % RELEASE_INTERVAL == RELEASE_INTERVAL - 1) {
+            file.releaseResidentPages();
+        }
+    }
+    
+    if (starts != 1 || exits != 1) {
+        return false;
     }
+    
+    width = newWidth;
+    height = newHeight;
+    seed = 0;
+    maze.swap(cells);
+    visited.assign(height, std::vector<bool>(width, false));
+    startX = newStartX;
+    startY = newStartY;
+    exitX = newExitX;
+    exitY = newExitY;
+    
+    passableStride = width + 2;
+    passable.assign((size_t)passableStride * (height + 2), 0);
+    rebuildPassability();
+    return true;
 }
 
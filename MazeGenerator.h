@@ -6,6 +6,8 @@
 #include <random>
 #include <algorithm>
 #include <utility>
+#include <cstdint>
+#include <string>
 
 /**
  * MazeGenerator class
@@ -17,12 +19,20 @@ class MazeGenerator {
 private:
     int width;      // Maze width (must be odd)
     int height;     // Maze height (must be odd)
+    uint32_t seed;  // Seed of the last generated maze (0 for a loaded maze)
+    int startX, startY;     // Start cell
+    int exitX, exitY;       // Exit cell
     
     // Graph representation: each cell is a node, connections are edges
     // Using 2D grid where each cell can connect to neighbors
     std::vector<std::vector<bool>> visited;  // Track visited cells in DFS
     std::vector<std::vector<char>> maze;     // Final maze representation
     
+    // Flat passability bitmap with a 1-cell wall border on every side,
+    // so neighbor lookups (index +/- 1, +/- stride) never need bounds checks
+    std::vector<unsigned char> passable;
+    int passableStride;
+    
     // Stack for DFS traversal
     struct Cell {
         int x, y;
@@ -33,17 +43,28 @@ private:
     bool isValidCell(int x, int y) const;
     std::vector<Cell> getUnvisitedNeighbors(int x, int y);
     void removeWall(int x1, int y1, int x2, int y2);
+    void rebuildPassability();
+    size_t formatRows(int firstRow, int rowCount, std::vector<char>& block) const;
     
 public:
     // Constructor
     MazeGenerator(int width = 21, int height = 21);
     
-    // Generate maze using DFS algorithm
+    // Generate maze using DFS algorithm (random seed)
     void generateMaze();
     
+    // Generate maze from a seed; the same seed and size always give the same maze
+    void generateMaze(uint32_t seed);
+    
+    // Seed of the last generated maze
+    uint32_t getSeed() const;
+    
     // Get maze representation
     std::vector<std::vector<char>> getMaze() const;
     
+    // Get one cell's character without copying the grid (no bounds check)
+    char getCell(int x, int y) const;
+    
     // Get dimensions
     int getWidth() const;
     int getHeight() const;
@@ -59,6 +80,28 @@ public:
     std::pair<int, int> getStartPosition() const;
     std::pair<int, int> getExitPosition() const;
     
+    // Dynamic maze edit API: open (wall = false) or close (wall = true) a cell
+    // Returns true if the cell actually changed
+    bool setWall(int x, int y, bool wall);
+    
+    // Check if a cell may be edited (border, start and exit are fixed)
+    bool isEditable(int x, int y) const;
+    
+    // Padded passability bitmap (1 = open), row stride = getPassabilityStride()
+    // Cell (x, y) lives at index getPassabilityIndex(x, y); x = -1 and
+    // x = width (same for y) are always 0
+    const unsigned char* getPassabilityGrid() const;
+    int getPassabilityStride() const;
+    int getPassabilityIndex(int x, int y) const;
+    
+    // Load a maze from a text file: '#' walls, ' ' paths, one 'S' and one 'E',
+    // one row per line ("\n" or "\r\n"). The file is memory-mapped and
+    // validated row by row; returns false (maze unchanged) if malformed
+    bool loadFromFile(const std::string& path);
+    
+    // Write the maze in the same text format, in large blocks
+    bool saveToFile(const std::string& path) const;
+    
     // Print maze (for debugging)
     void printMaze() const;
 };
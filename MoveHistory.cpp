@@ -0,0 +1,145 @@
+#include "MoveHistory.h"
+
+const int MoveHistory::DX[4] = {0, 0, -1, 1};
+const int MoveHistory::DY[4] = {-1, 1, 0, 0};
+
+/**
+ * Constructor: Empty history at the origin
+ */
+MoveHistory::MoveHistory() : moveCount(0), originX(0), originY(0), lastX(0), lastY(0) {
+}
+
+/**
+ * Clear the log and set the origin
+ * Chunks are released so a finished run doesn't pin its memory
+ */
+void MoveHistory::reset(int x, int y) {
+    chunks.clear();
+    moveCount = 0;
+    originX = lastX = x;
+    originY = lastY = y;
+}
+
+/**
+ * Append one move (2-bit code)
+ * A new chunk records the current position as its checkpoint
+ */
+void MoveHistory::append(uint8_t direction) {
+    size_t offset = moveCount % CHUNK_MOVES;
+
+    if (offset == 0) {
+        std::unique_ptr<Chunk> chunk(new Chunk());
+        chunk->startX = lastX;
+        chunk->startY = lastY;
+        chunks.push_back(std::move(chunk));
+    }
+
+    Chunk& chunk = *chunks.back();
+    size_t word = offset / CODES_PER_WORD;
+    int shift = (offset % CODES_PER_WORD) * 2;
+    chunk.codes[word] |= (uint64_t)(direction & 3) << shift;
+
+    lastX += DX[direction & 3];
+    lastY += DY[direction & 3];
+    moveCount++;
+}
+
+/**
+ * Drop moves after the first 'moves'
+ * Whole chunks past the cut are freed, the cut chunk has its tail bits
+ * cleared so later appends can keep OR-ing codes in
+ */
+void MoveHistory::truncate(size_t moves) {
+    if (moves >= moveCount) {
+        return;
+    }
+
+    std::pair<int, int> position = positionAt(moves);
+    chunks.resize((moves + CHUNK_MOVES - 1) / CHUNK_MOVES);
+
+    size_t offset = moves % CHUNK_MOVES;
+    if (offset != 0) {
+        Chunk& chunk = *chunks.back();
+        size_t word = offset / CODES_PER_WORD;
+        int bits = (offset % CODES_PER_WORD) * 2;
+        chunk.codes[word] &= (bits == 0) ? 0 : ((uint64_t)1 << bits) - 1;
+        for (size_t w = word + 1; w < CHUNK_WORDS; w++) {
+            chunk.codes[w] = 0;
+        }
+    }
+
+    moveCount = moves;
+    lastX = position.first;
+    lastY = position.second;
+}
+
+/**
+ * Get number of recorded moves
+ */
+size_t MoveHistory::moves() const {
+    return moveCount;
+}
+
+/**
+ * Get number of positions (origin included)
+ */
+size_t MoveHistory::size() const {
+    return moveCount + 1;
+}
+
+/**
+ * Get direction code of a move
+ */
+uint8_t MoveHistory::directionAt(size_t move) const {
+    const Chunk& chunk = *chunks[move / CHUNK_MOVES];
+    size_t offset = move % CHUNK_MOVES;
+    return (chunk.codes[offset / CODES_PER_WORD] >> ((offset % CODES_PER_WORD) * 2)) & 3;
+}
+
+/**
+ * Get position after 'index' moves
+ * Starts at the chunk checkpoint, so at most CHUNK_MOVES codes are decoded
+ */
+std::pair<int, int> MoveHistory::positionAt(size_t index) const {
+    if (index == 0 || moveCount == 0) {
+        return std::make_pair(originX, originY);
+    }
+    if (index >= moveCount) {
+        return std::make_pair(lastX, lastY);
+    }
+
+    size_t chunkIndex = index / CHUNK_MOVES;
+    const Chunk& chunk = *chunks[chunkIndex];
+    int x = chunk.startX;
+    int y = chunk.startY;
+
+    size_t count = index % CHUNK_MOVES;
+    for (size_t i = 0; i < count; i++) {
+        uint8_t code = (chunk.codes[i / CODES_PER_WORD] >> ((i % CODES_PER_WORD) * 2)) & 3;
+        x += DX[code];
+        y += DY[code];
+    }
+
+    return std::make_pair(x, y);
+}
+
+/**
+ * Get most recent position
+ */
+std::pair<int, int> MoveHistory::back() const {
+    return std::make_pair(lastX, lastY);
+}
+
+/**
+ * Iterator to the origin
+ */
+MoveHistory::const_iterator MoveHistory::begin() const {
+    return const_iterator(this, 0, std::make_pair(originX, originY));
+}
+
+/**
+ * Iterator past the last position
+ */
+MoveHistory::const_iterator MoveHistory::end() const {
+    return const_iterator(this, moveCount + 1, std::make_pair(lastX, lastY));
+}
@@ -0,0 +1,118 @@
+#ifndef MOVE_HISTORY_H
+#define MOVE_HISTORY_H
+
+#include <vector>
+#include <memory>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+#include <iterator>
+
+/**
+ * MoveHistory class
+ * Compact move log: every move is a 2-bit direction code packed into
+ * fixed-size chunks, and each chunk starts with an absolute checkpoint
+ * position. Appending never allocates except once per chunk, any position
+ * can be recovered by decoding at most one chunk, and iteration walks the
+ * log in place without copying it
+ * Member: 2 - Player control
+ */
+class MoveHistory {
+public:
+    // Direction codes (same order as the pathfinders: up, down, left, right)
+    enum Direction : uint8_t { UP = 0, DOWN = 1, LEFT = 2, RIGHT = 3 };
+
+    static const int CHUNK_MOVES = 4096;                      // Moves per chunk
+    static const int CODES_PER_WORD = 32;                     // 2 bits per move
+    static const int CHUNK_WORDS = CHUNK_MOVES / CODES_PER_WORD;
+
+    static const int DX[4];
+    static const int DY[4];
+
+private:
+    // One chunk: checkpoint + packed codes (1 KB of moves)
+    struct Chunk {
+        int startX, startY;               // Position before the chunk's first move
+        uint64_t codes[CHUNK_WORDS];
+    };
+
+    std::vector<std::unique_ptr<Chunk>> chunks;
+    size_t moveCount;
+    int originX, originY;
+    int lastX, lastY;
+
+public:
+    /**
+     * Forward iterator over positions (origin first, then one per move)
+     * Decodes in place, each increment is O(1)
+     */
+    class const_iterator {
+    private:
+        const MoveHistory* history;
+        size_t index;             // Position index (0 = origin)
+        std::pair<int, int> position;
+
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef std::pair<int, int> value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const std::pair<int, int>* pointer;
+        typedef const std::pair<int, int>& reference;
+
+        const_iterator(const MoveHistory* history, size_t index, std::pair<int, int> position)
+            : history(history), index(index), position(position) {}
+
+        reference operator*() const { return position; }
+        pointer operator->() const { return &position; }
+
+        const_iterator& operator++() {
+            if (index < history->moveCount) {
+                uint8_t code = history->directionAt(index);
+                position.first += DX[code];
+                position.second += DY[code];
+            }
+            index++;
+            return *this;
+        }
+
+        const_iterator operator++(int) {
+            const_iterator copy = *this;
+            ++(*this);
+            return copy;
+        }
+
+        bool operator==(const const_iterator& other) const { return index == other.index; }
+        bool operator!=(const const_iterator& other) const { return index != other.index; }
+    };
+
+    // Constructor
+    MoveHistory();
+
+    // Clear the log and set the origin position
+    void reset(int x, int y);
+
+    // Append one move by direction code
+    void append(uint8_t direction);
+    
+    // Drop every move after the first 'moves' (discards a redo tail)
+    void truncate(size_t moves);
+
+    // Number of recorded moves (positions = moves + 1)
+    size_t moves() const;
+    size_t size() const;
+
+    // Direction code of move i (0-based)
+    uint8_t directionAt(size_t move) const;
+
+    // Position after 'index' moves, decoded from the nearest checkpoint
+    std::pair<int, int> positionAt(size_t index) const;
+
+    // Most recent position
+    std::pair<int, int> back() const;
+
+    // Zero-copy iteration over all positions
+    const_iterator begin() const;
+    const_iterator end() const;
+};
+
+#endif // MOVE_HISTORY_H
@@ -0,0 +1,212 @@
+#include "PathSearch.h"
+#include <algorithm>
+#include <limits>
+
+/**
+ * Constructor: Initialize per-cell state and seed the frontier with start
+ */
+PathSearch::PathSearch(Algorithm algorithm, int startX, int startY,
+                       int endX, int endY, const MazeGenerator& maze)
+    : algorithm(algorithm), status(Status::Running),
+      width(maze.getWidth()), height(maze.getHeight()),
+      startIndex(startY * maze.getWidth() + startX),
+      endIndex(endY * maze.getWidth() + endX),
+      maze(&maze), bfsHead(0), exploredCount(0) {
+
+    int cells = width * height;
+    parent.assign(cells, -1);
+    distance.assign(cells, std::numeric_limits<int>::max());
+
+    if (startX < 0 || startX >= width || startY < 0 || startY >= height ||
+        endX < 0 || endX >= width || endY < 0 || endY >= height) {
+        status = Status::NoPath;
+        return;
+    }
+
+    // Start is its own parent so it counts as discovered
+    parent[startIndex] = startIndex;
+    distance[startIndex] = 0;
+
+    if (algorithm == Algorithm::BFS) {
+        bfsQueue.reserve(64);
+        bfsQueue.push_back(startIndex);
+    } else {
+        settled.assign(cells, false);
+        heap.push(std::make_pair(0, startIndex));
+    }
+}
+
+/**
+ * Discover neighbor (nx, ny) from cell index 'from'
+ */
+void PathSearch::relax(int from, int nx, int ny) {
+    if (nx < 0 || nx >= width || ny < 0 || ny >= height || !maze->isValidPath(nx, ny)) {
+        return;
+    }
+
+    int next = ny * width + nx;
+    int newCost = distance[from] + 1;  // Each step costs 1
+
+    if (algorithm == Algorithm::BFS) {
+        if (parent[next] == -1) {
+            parent[next] = from;
+            distance[next] = newCost;
+            bfsQueue.push_back(next);
+        }
+    } else if (!settled[next] && newCost < distance[next]) {
+        parent[next] = from;
+        distance[next] = newCost;
+        heap.push(std::make_pair(newCost, next));
+    }
+}
+
+/**
+ * Expand a single node from the frontier
+ * Neighbor order matches AIPathfinder: up, down, left, right
+ */
+bool PathSearch::expandOne() {
+    int current;
+
+    if (algorithm == Algorithm::BFS) {
+        if (bfsHead >= bfsQueue.size()) {
+            return false;
+        }
+        current = bfsQueue[bfsHead++];
+    } else {
+        // Skip stale heap entries
+        do {
+            if (heap.empty()) {
+                return false;
+            }
+            current = heap.top().second;
+            heap.pop();
+        } while (settled[current]);
+        settled[current] = true;
+    }
+
+    int x = current % width;
+    int y = current / width;
+    newlyExplored.push_back(std::make_pair(x, y));
+    exploredCount++;
+
+    if (current == endIndex) {
+        status = Status::Found;
+        return true;
+    }
+
+    relax(current, x, y - 1);
+    relax(current, x, y + 1);
+    relax(current, x - 1, y);
+    relax(current, x + 1, y);
+    return true;
+}
+
+/**
+ * Expand up to nodeBudget nodes
+ */
+PathSearch::Status PathSearch::step(int nodeBudget) {
+    newlyExplored.clear();
+
+    for (int i = 0; i < nodeBudget && status == Status::Running; i++) {
+        if (!expandOne()) {
+            status = Status::NoPath;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * Expand nodes until the time budget (or optional node budget) is spent
+ * The clock is only sampled every few nodes to keep overhead low
+ */
+PathSearch::Status PathSearch::stepFor(std::chrono::microseconds timeBudget, int nodeBudget) {
+    const int CHECK_INTERVAL = 64;
+    auto deadline = std::chrono::steady_clock::now() + timeBudget;
+    int expanded = 0;
+
+    newlyExplored.clear();
+
+    while (status == Status::Running && expanded < nodeBudget) {
+        int batch = std::min(CHECK_INTERVAL, nodeBudget - expanded);
+        for (int i = 0; i < batch && status == Status::Running; i++) {
+            if (!expandOne()) {
+                status = Status::NoPath;
+            }
+        }
+        expanded += batch;
+        if (std::chrono::steady_clock::now() >= deadline) {
+            break;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * Run the search to completion
+ */
+PathSearch::Status PathSearch::run() {
+    newlyExplored.clear();
+
+    while (status == Status::Running) {
+        if (!expandOne()) {
+            status = Status::NoPath;
+        }
+        // Nobody is animating a full run, don't let the buffer grow
+        if (newlyExplored.size() >= 4096) {
+            newlyExplored.clear();
+        }
+    }
+    newlyExplored.clear();
+
+    return status;
+}
+
+/**
+ * Get cells expanded during the most recent step
+ */
+const std::vector<std::pair<int, int>>& PathSearch::getNewlyExplored() const {
+    return newlyExplored;
+}
+
+/**
+ * Get current status
+ */
+PathSearch::Status PathSearch::getStatus() const {
+    return status;
+}
+
+/**
+ * Check whether the search has terminated
+ */
+bool PathSearch::isFinished() const {
+    return status != Status::Running;
+}
+
+/**
+ * Get number of nodes expanded so far
+ */
+int PathSearch::getExploredCount() const {
+    return exploredCount;
+}
+
+/**
+ * Reconstruct path by following parent links back from the end
+ */
+std::vector<std::pair<int, int>> PathSearch::getPath() const {
+    std::vector<std::pair<int, int>> path;
+    if (status != Status::Found) {
+        return path;
+    }
+
+    int current = endIndex;
+    while (current != startIndex) {
+        path.push_back(std::make_pair(current % width, current / width));
+        current = parent[current];
+    }
+    path.push_back(std::make_pair(current % width, current / width));
+
+    std::reverse(path.begin(), path.end());
+    return path;
+}
@@ -0,0 +1,83 @@
+#ifndef PATH_SEARCH_H
+#define PATH_SEARCH_H
+
+#include <vector>
+#include <queue>
+#include <chrono>
+#include <utility>
+#include <functional>
+#include <limits>
+#include "MazeGenerator.h"
+
+/**
+ * PathSearch class
+ * Resumable BFS / Dijkstra search that advances in bounded slices
+ * Each call to step() expands at most a node budget (or runs for at most
+ * a time budget) and exposes the cells expanded during that slice, so the
+ * UI can animate the search frontier without stalling a frame
+ * Member: 3 - Pathfinding algorithms
+ */
+class PathSearch {
+public:
+    enum class Algorithm { BFS, Dijkstra };
+    enum class Status { Running, Found, NoPath };
+
+private:
+    Algorithm algorithm;
+    Status status;
+    int width;
+    int height;
+    int startIndex;
+    int endIndex;
+    const MazeGenerator* maze;
+
+    // Flat per-cell state (index = y * width + x)
+    std::vector<int> parent;      // -1 = not discovered yet
+    std::vector<int> distance;    // Best known cost from start
+    std::vector<bool> settled;    // Expanded (Dijkstra only)
+
+    // BFS frontier: vector used as a queue with a moving head
+    std::vector<int> bfsQueue;
+    size_t bfsHead;
+
+    // Dijkstra frontier: Min Heap of (cost, cell index)
+    std::priority_queue<std::pair<int, int>, std::vector<std::pair<int, int>>,
+                        std::greater<std::pair<int, int>>> heap;
+
+    // Cells expanded during the most recent step
+    std::vector<std::pair<int, int>> newlyExplored;
+    int exploredCount;
+
+    // Expand a single node, returns false when the frontier is exhausted
+    bool expandOne();
+    void relax(int from, int nx, int ny);
+
+public:
+    // Constructor: prepares the search, no nodes are expanded yet
+    PathSearch(Algorithm algorithm, int startX, int startY,
+               int endX, int endY, const MazeGenerator& maze);
+
+    // Expand up to nodeBudget nodes
+    Status step(int nodeBudget);
+
+    // Expand nodes until the time budget is spent
+    // (stops early once nodeBudget nodes have been expanded)
+    Status stepFor(std::chrono::microseconds timeBudget,
+                   int nodeBudget = std::numeric_limits<int>::max());
+
+    // Run the search to completion
+    Status run();
+
+    // Cells expanded during the most recent step()/stepFor() call
+    const std::vector<std::pair<int, int>>& getNewlyExplored() const;
+
+    // Get current status and progress
+    Status getStatus() const;
+    bool isFinished() const;
+    int getExploredCount() const;
+
+    // Get path from start to end (empty unless status is Found)
+    std::vector<std::pair<int, int>> getPath() const;
+};
+
+#endif // PATH_SEARCH_H
@@ -1,18 +1,18 @@
 #include "Player.h"
 #include <iostream>
+#include <cstdlib>
 
-/**
- * Constructor: Initialize player
- */
-Player::Player() : x(0), y(0), startX(0), startY(0), moves(0), 
-                   moveHistoryHead(nullptr), moveHistoryTail(nullptr) {
-}
+namespace {
+
+// Session letters for MoveHistory direction codes (up, down, left, right)
+const char MOVE_LETTERS[4] = {'w', 's', 'a', 'd'};
+
+} // namespace
 
 /**
- * Destructor: Clean up move history linked list
+ * Constructor: Initialize player
  */
-Player::~Player() {
-    clearHistory();
+Player::Player() : x(0), y(0), startX(0), startY(0), moves(0), sessionMoves(0), actionCount(0) {
 }
 
 /**
@@ -24,34 +24,8 @@ void Player::initialize(int startX, int startY) {
     this->startX = startX;
     this->startY = startY;
     this->moves = 0;
-    clearHistory();
-    addToHistory(startX, startY);
-}
-
-/**
- * Add move to history (Linked List implementation)
- */
-void Player::addToHistory(int x, int y) {
-    MoveNode* newNode = new MoveNode(x, y);
-    
-    if (moveHistoryHead == nullptr) {
-        moveHistoryHead = moveHistoryTail = newNode;
-    } else {
-        moveHistoryTail->next = newNode;
-        moveHistoryTail = newNode;
-    }
-}
-
-/**
- * Clear move history
- */
-void Player::clearHistory() {
-    while (moveHistoryHead != nullptr) {
-        MoveNode* temp = moveHistoryHead;
-        moveHistoryHead = moveHistoryHead->next;
-        delete temp;
-    }
-    moveHistoryTail = nullptr;
+    moveHistory.reset(startX, startY);
+    clearSession();
 }
 
 /**
@@ -60,43 +34,124 @@ void Player::clearHistory() {
  * Returns true if move was successful, false if blocked
  */
 bool Player::move(char direction, const MazeGenerator& maze) {
-    int newX = x;
-    int newY = y;
+    uint8_t code;
     
     // Calculate new position based on direction
     switch (direction) {
         case 'W':
         case 'w':
-            newY--;
+            code = MoveHistory::UP;
             break;
         case 'S':
         case 's':
-            newY++;
+            code = MoveHistory::DOWN;
             break;
         case 'A':
         case 'a':
-            newX--;
+            code = MoveHistory::LEFT;
             break;
         case 'D':
         case 'd':
-            newX++;
+            code = MoveHistory::RIGHT;
             break;
         default:
             return false;
     }
     
+    int newX = x + MoveHistory::DX[code];
+    int newY = y + MoveHistory::DY[code];
+    
     // Check if move is valid (collision detection)
     if (isValidMove(newX, newY, maze)) {
         x = newX;
         y = newY;
+        truncateHistory();
         moves++;
-        addToHistory(x, y);
+        moveHistory.append(code);
+        sessionMoves++;
+        actionCount++;
         return true;
     }
     
     return false;
 }
 
+/**
+ * Apply a whole move sequence in one call
+ * Direction chars are decoded through a lookup table and each step is one
+ * load from the padded passability bitmap; exit detection is an index compare
+ */
+Player::MoveBatchResult Player::applyMoves(const char* sequence, size_t length,
+                                           const MazeGenerator& maze, bool stopAtExit) {
+    // Direction char -> MoveHistory code (-1 = not a move)
+    static const struct DirectionTable {
+        signed char code[256];
+        DirectionTable() {
+            for (int i = 0; i < 256; i++) code[i] = -1;
+            code[(unsigned char)'W'] = code[(unsigned char)'w'] = MoveHistory::UP;
+            code[(unsigned char)'S'] = code[(unsigned char)'s'] = MoveHistory::DOWN;
+            code[(unsigned char)'A'] = code[(unsigned char)'a'] = MoveHistory::LEFT;
+            code[(unsigned char)'D'] = code[(unsigned char)'d'] = MoveHistory::RIGHT;
+        }
+    } table;
+    
+    const unsigned char* grid = maze.getPassabilityGrid();
+    const int stride = maze.getPassabilityStride();
+    const int delta[4] = {-stride, stride, -1, 1};
+    
+    std::pair<int, int> exitPos = maze.getExitPosition();
+    const int exitIndex = maze.getPassabilityIndex(exitPos.first, exitPos.second);
+    
+    MoveBatchResult result;
+    result.applied = 0;
+    result.blocked = 0;
+    result.exitIndex = -1;
+    
+    int index = maze.getPassabilityIndex(x, y);
+    truncateHistory();
+    
+    for (size_t i = 0; i < length; i++) {
+        int code = table.code[(unsigned char)sequence[i]];
+        if (code < 0) {
+            result.blocked++;
+            continue;
+        }
+        
+        int next = index + delta[code];
+        if (!grid[next]) {
+            result.blocked++;
+            continue;
+        }
+        
+        index = next;
+        moveHistory.append((uint8_t)code);
+        result.applied++;
+        
+        if (index == exitIndex && result.exitIndex < 0) {
+            result.exitIndex = (long long)i;
+            if (stopAtExit) break;
+        }
+    }
+    
+    x = index % stride - 1;
+    y = index / stride - 1;
+    moves += (int)result.applied;
+    sessionMoves += result.applied;
+    actionCount += (int)result.applied;
+    
+    result.x = x;
+    result.y = y;
+    return result;
+}
+
+/**
+ * Apply a whole move string in one call
+ */
+Player::MoveBatchResult Player::applyMoves(const std::string& sequence,
+                                           const MazeGenerator& maze, bool stopAtExit) {
+    return applyMoves(sequence.data(), sequence.size(), maze, stopAtExit);
+}
+
 /**
  * Check if move is valid (collision detection)
  */
@@ -131,23 +186,20 @@ int Player::getMoves() const {
     return moves;
 }
 
+/**
+ * Get number of charged steps, undo / redo steps included
+ */
+int Player::getActionCount() const {
+    return actionCount;
+}
+
 /**
  * Check if player reached exit
  */
 bool Player::hasReachedExit(const MazeGenerator& maze) const {
-    auto mazeGrid = maze.getMaze();
-    if (y >= 0 && y < maze.getHeight() && x >= 0 && x < maze.getWidth()) {
-        char cell = mazeGrid[y][x];
-        // Check if current position is exit (E) or if we're at the exit coordinates
-        if (cell == 'E') {
-            return true;
-        }
-        // Also check if we're at the exit position (bottom-right)
-        int exitX = maze.getWidth() - 2;
-        int exitY = maze.getHeight() - 2;
-        return (x == exitX && y == exitY);
-    }
-    return false;
+    // Compare coordinates instead of copying the maze to read one cell
+    std::pair<int, int> exitPos = maze.getExitPosition();
+    return x == exitPos.first && y == exitPos.second;
 }
 
 /**
@@ -157,22 +209,216 @@ void Player::reset() {
     x = startX;
     y = startY;
     moves = 0;
-    clearHistory();
-    addToHistory(x, y);
+    moveHistory.reset(x, y);
+    clearSession();
+}
+
+/**
+ * Forget the session log
+ */
+void Player::clearSession() {
+    sessionEvents.clear();
+    discardedTails.clear();
+    discardedCodes.clear();
+    sessionMoves = 0;
+    actionCount = 0;
+}
+
+/**
+ * Drop the redo tail before a new move
+ * The tail is copied to the session log first: the replay still has to
+ * show the moves that were undone
+ */
+void Player::truncateHistory() {
+    size_t length = moveHistory.moves();
+    if ((size_t)moves >= length) {
+        return;
+    }
+    
+    DiscardedTail tail;
+    tail.run = sessionEvents.size();
+    tail.begin = discardedCodes.size();
+    tail.length = length - (size_t)moves;
+    for (size_t i = (size_t)moves; i < length; i++) {
+        discardedCodes.push_back(moveHistory.directionAt(i));
+    }
+    discardedTails.push_back(tail);
+    
+    moveHistory.truncate(moves);
+}
+
+/**
+ * Step back over the last move
+ */
+void Player::stepBack() {
+    uint8_t code = moveHistory.directionAt(moves - 1);
+    x -= MoveHistory::DX[code];
+    y -= MoveHistory::DY[code];
+    moves--;
 }
 
 /**
- * Get move history as a list
+ * Step forward over the next move of the history
  */
-std::list<std::pair<int, int>> Player::getMoveHistory() const {
-    std::list<std::pair<int, int>> history;
-    MoveNode* current = moveHistoryHead;
+void Player::stepForward() {
+    uint8_t code = moveHistory.directionAt(moves);
+    x += MoveHistory::DX[code];
+    y += MoveHistory::DY[code];
+    moves++;
+}
+
+/**
+ * Undo the last move
+ */
+bool Player::undo(const MazeGenerator& maze) {
+    if (!canUndo()) {
+        return false;
+    }
+    
+    uint8_t code = moveHistory.directionAt(moves - 1);
+    if (!isValidMove(x - MoveHistory::DX[code], y - MoveHistory::DY[code], maze)) {
+        return false;
+    }
+    
+    stepBack();
+    sessionEvents.push_back(SessionEvent{sessionMoves, 'u', moves});
+    actionCount++;
+    return true;
+}
+
+/**
+ * Redo the next move from the history
+ */
+bool Player::redo(const MazeGenerator& maze) {
+    if (!canRedo()) {
+        return false;
+    }
+    
+    uint8_t code = moveHistory.directionAt(moves);
+    if (!isValidMove(x + MoveHistory::DX[code], y + MoveHistory::DY[code], maze)) {
+        return false;
+    }
+    
+    stepForward();
+    sessionEvents.push_back(SessionEvent{sessionMoves, 'r', moves});
+    actionCount++;
+    return true;
+}
+
+/**
+ * Check if there is a move to undo
+ */
+bool Player::canUndo() const {
+    return moves > 0;
+}
+
+/**
+ * Check if there is a move to redo
+ */
+bool Player::canRedo() const {
+    return (size_t)moves < moveHistory.moves();
+}
+
+/**
+ * Rewind (or fast-forward) to the position after 'step' moves
+ * Charged like the equivalent run of undo / redo steps, logged as one event
+ */
+bool Player::rewindTo(int step, const MazeGenerator& maze) {
+    if (step < 0 || (size_t)step > moveHistory.moves()) {
+        return false;
+    }
+    
+    std::pair<int, int> position = moveHistory.positionAt(step);
+    if (!isValidMove(position.first, position.second, maze)) {
+        return false;
+    }
     
-    while (current != nullptr) {
-        history.push_back(std::make_pair(current->x, current->y));
-        current = current->next;
+    if (step == moves) {
+        return true;
     }
     
-    return history;
+    sessionEvents.push_back(SessionEvent{sessionMoves, 't', step});
+    actionCount += std::abs(step - moves);
+    x = position.first;
+    y = position.second;
+    moves = step;
+    return true;
+}
+
+/**
+ * Get total recorded moves (including redo tail)
+ */
+int Player::getHistoryLength() const {
+    return (int)moveHistory.moves();
+}
+
+/**
+ * Build the session key stream: w/a/s/d moves, u / r undo / redo steps and
+ * t<step> rewinds
+ * The moves between two events form a run starting at a known history
+ * index. Walking the runs backwards, a run's moves are the history entries
+ * at its indices, and putting back the tail its first move discarded gives
+ * the history as it was before the run
+ */
+std::string Player::getSessionString() const {
+    size_t runs = sessionEvents.size() + 1;
+    std::vector<long long> runLength(runs);
+    std::vector<size_t> runIndex(runs);
+    
+    long long made = 0;
+    long long cursor = 0;
+    for (size_t r = 0; r < runs; r++) {
+        long long end = (r < sessionEvents.size()) ? sessionEvents[r].moveNumber : sessionMoves;
+        runLength[r] = end - made;
+        runIndex[r] = (size_t)cursor;
+        cursor += end - made;
+        made = end;
+        
+        if (r < sessionEvents.size()) {
+            cursor = sessionEvents[r].step;
+        }
+    }
+    
+    std::vector<uint8_t> codes(moveHistory.moves());
+    for (size_t i = 0; i < codes.size(); i++) {
+        codes[i] = moveHistory.directionAt(i);
+    }
+    
+    std::vector<std::string> runText(runs);
+    size_t tail = discardedTails.size();
+    for (size_t r = runs; r-- > 0;) {
+        size_t begin = runIndex[r];
+        for (long long k = 0; k < runLength[r]; k++) {
+            runText[r].push_back(MOVE_LETTERS[codes[begin + (size_t)k]]);
+        }
+        
+        if (tail > 0 && discardedTails[tail - 1].run == r) {
+            const DiscardedTail& discarded = discardedTails[--tail];
+            codes.resize(begin);
+            codes.insert(codes.end(), discardedCodes.begin() + discarded.begin,
+                         discardedCodes.begin() + discarded.begin + discarded.length);
+        } else if (runLength[r] > 0) {
+            codes.resize(begin);
+        }
+    }
+    
+    std::string keys;
+    for (size_t r = 0; r < runs; r++) {
+        keys += runText[r];
+        if (r < sessionEvents.size()) {
+            keys += sessionEvents[r].kind;
+            if (sessionEvents[r].kind == 't') {
+                keys += std::to_string(sessionEvents[r].step);
+            }
+        }
+    }
+    return keys;
+}
+
+/**
+ * Get move history view (no copy)
+ */
+const MoveHistory& Player::getMoveHistory() const {
+    return moveHistory;
 }
 
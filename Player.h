@@ -2,13 +2,14 @@
 #define PLAYER_H
 
 #include <vector>
-#include <list>
+#include <string>
 #include "MazeGenerator.h"
+#include "MoveHistory.h"
 
 /**
  * Player class
  * Handles player movement, collision detection, and position tracking
- * Uses Linked List for move history
+ * Uses a packed MoveHistory (2-bit codes + checkpoints) for move history
  * Member: 2 - Player control
  */
 class Player {
@@ -17,31 +18,56 @@ private:
     int y;              // Current Y position
     int startX;         // Starting X position
     int startY;         // Starting Y position
-    int moves;          // Number of moves made
+    int moves;          // Number of moves made (also the undo cursor into history)
     
-    // Linked List for move history
-    struct MoveNode {
-        int x, y;
-        MoveNode* next;
-        MoveNode(int x, int y) : x(x), y(y), next(nullptr) {}
+    // Packed move history (origin + one direction code per move)
+    MoveHistory moveHistory;
+    
+    // Session side log for replays: moves are only counted, the log holds
+    // the undo / redo / rewind events (stamped with the number of moves
+    // made before them) and the redo tails a new move discarded, which
+    // moveHistory no longer has. The moves themselves come back from
+    // moveHistory when the session string is built
+    struct SessionEvent {
+        long long moveNumber;   // Session moves made before the event
+        char kind;              // 'u' undo, 'r' redo, 't' rewind
+        int step;               // Moves on the history after it (rewind target)
+    };
+    
+    struct DiscardedTail {
+        size_t run;             // Events logged before it (one tail per run of moves at most)
+        size_t begin;           // Direction codes in discardedCodes
+        size_t length;
     };
     
-    MoveNode* moveHistoryHead;  // Head of move history linked list
-    MoveNode* moveHistoryTail;  // Tail of move history linked list
+    std::vector<SessionEvent> sessionEvents;
+    std::vector<DiscardedTail> discardedTails;
+    std::vector<uint8_t> discardedCodes;
+    long long sessionMoves;     // Moves made this session (undone ones included)
+    int actionCount;            // Charged steps: moves plus undo / redo steps
+    
+    // Undo / redo one step without checking the maze
+    void stepBack();
+    void stepForward();
     
-    // Helper function to add move to history
-    void addToHistory(int x, int y);
+    // Drop the redo tail before a new move, keeping it for the session string
+    void truncateHistory();
     
-    // Clear move history
-    void clearHistory();
+    // Forget the session log
+    void clearSession();
     
 public:
+    // Result of applying a whole move sequence
+    struct MoveBatchResult {
+        int x, y;               // Final position
+        long long applied;      // Moves that succeeded
+        long long blocked;      // Moves into walls or unknown direction chars
+        long long exitIndex;    // Index in the sequence where the exit was reached, -1 if never
+    };
+    
     // Constructor
     Player();
     
-    // Destructor
-    ~Player();
-    
     // Initialize player at start position
     void initialize(int startX, int startY);
     
@@ -49,21 +75,57 @@ public:
     // Returns true if move was successful, false if blocked
     bool move(char direction, const MazeGenerator& maze);
     
+    // Apply a whole move string in one call (bots and replays)
+    // Uses the maze passability bitmap directly: no per-move validation
+    // calls, no allocations (beyond one history chunk per 4096 moves)
+    // Stops at the exit unless stopAtExit is false
+    MoveBatchResult applyMoves(const char* sequence, size_t length,
+                               const MazeGenerator& maze, bool stopAtExit = true);
+    MoveBatchResult applyMoves(const std::string& sequence,
+                               const MazeGenerator& maze, bool stopAtExit = true);
+    
     // Get current position
     int getX() const;
     int getY() const;
     
-    // Get number of moves
+    // Get number of moves (net moves from the start to the current step)
     int getMoves() const;
     
+    // Steps charged this session: moves plus every undone / redone step,
+    // a rewind counting one per step crossed (scored count)
+    int getActionCount() const;
+    
     // Check if player reached exit
     bool hasReachedExit(const MazeGenerator& maze) const;
     
     // Reset player to start position
     void reset();
     
+    // Undo / redo a single move in O(1) by reversing its direction code
+    // Refused if the cell it returns to is a wall now (shifting walls)
+    // A new move after an undo discards the redo tail
+    bool undo(const MazeGenerator& maze);
+    bool redo(const MazeGenerator& maze);
+    bool canUndo() const;
+    bool canRedo() const;
+    
+    // Jump to the position after 'step' moves (0 = start), refused if that
+    // cell is a wall now; charged as one undo / redo per step crossed but
+    // logged as a single event
+    // Decodes from the nearest history checkpoint, so the cost is bounded
+    // by MoveHistory::CHUNK_MOVES no matter how long the session is
+    bool rewindTo(int step, const MazeGenerator& maze);
+    
+    // Total recorded moves, including any redo tail
+    int getHistoryLength() const;
+    
+    // The session as a replay key stream: w/a/s/d moves, u / r for undo /
+    // redo and t<step> for a rewind (built from the history and the log)
+    std::string getSessionString() const;
+    
     // Get move history (for analysis)
-    std::list<std::pair<int, int>> getMoveHistory() const;
+    // Zero-copy view: iterate it to get every position from the start
+    const MoveHistory& getMoveHistory() const;
     
     // Check if move is valid (collision detection)
     bool isValidMove(int newX, int newY, const MazeGenerator& maze) const;
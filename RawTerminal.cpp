@@ -0,0 +1,270 @@
+#include "RawTerminal.h"
+
+#ifdef _WIN32
+    #include <conio.h>
+#else
+    #include <unistd.h>
+    #include <poll.h>
+    #include <cerrno>
+    #include <chrono>
+    #include <algorithm>
+#endif
+
+#ifndef _WIN32
+namespace {
+
+// Longest escape sequence kept while waiting for its final byte
+const size_t MAX_SEQUENCE_BYTES = 32;
+
+/**
+ * Steady clock in milliseconds
+ */
+long long steadyMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * Arrow key for a CSI / SS3 final byte, 0 for anything else
+ */
+int arrowKey(unsigned char finalByte) {
+    switch (finalByte) {
+        case 'A': return RawTerminal::KEY_UP;
+        case 'B': return RawTerminal::KEY_DOWN;
+        case 'C': return RawTerminal::KEY_RIGHT;
+        case 'D': return RawTerminal::KEY_LEFT;
+        default: return 0;
+    }
+}
+
+} // namespace
+#endif
+
+/**
+ * Constructor: Save the terminal mode and switch to raw input
+ */
+RawTerminal::RawTerminal() : active(false) {
+#ifdef _WIN32
+    input = GetStdHandle(STD_INPUT_HANDLE);
+    if (GetConsoleMode(input, &savedMode)) {
+        DWORD mode = savedMode & ~(ENABLE_LINE_INPUT | ENABLE_ECHO_INPUT | ENABLE_PROCESSED_INPUT);
+        active = SetConsoleMode(input, mode) != 0;
+    }
+#else
+    pendingSinceMs = 0;
+    if (isatty(STDIN_FILENO) && tcgetattr(STDIN_FILENO, &savedMode) == 0) {
+        struct termios raw = savedMode;
+        // Byte-at-a-time, no echo, Ctrl+C/Ctrl+Z arrive as keys; output
+        // processing stays on so "\n" still starts a new line
+        raw.c_lflag &= ~(ICANON | ECHO | ISIG | IEXTEN);
+        raw.c_iflag &= ~(IXON);
+        raw.c_cc[VMIN] = 1;
+        raw.c_cc[VTIME] = 0;
+        active = tcsetattr(STDIN_FILENO, TCSANOW, &raw) == 0;
+    }
+#endif
+}
+
+/**
+ * Destructor: Restore the saved mode
+ */
+RawTerminal::~RawTerminal() {
+    restore();
+}
+
+/**
+ * Restore the saved mode
+ */
+void RawTerminal::restore() {
+    if (!active) {
+        return;
+    }
+#ifdef _WIN32
+    SetConsoleMode(input, savedMode);
+#else
+    tcsetattr(STDIN_FILENO, TCSANOW, &savedMode);
+#endif
+    active = false;
+}
+
+/**
+ * Check if raw mode is on
+ */
+bool RawTerminal::isActive() const {
+    return active;
+}
+
+/**
+ * Wait for input and decode every queued key
+ */
+int RawTerminal::readKeys(int timeoutMs, std::vector<int>& keys) {
+    size_t before = keys.size();
+
+#ifdef _WIN32
+    if (WaitForSingleObject(input, timeoutMs < 0 ? INFINITE : (DWORD)timeoutMs) != WAIT_OBJECT_0) {
+        return 0;
+    }
+    while (_kbhit()) {
+        int ch = _getch();
+        if (ch == 0 || ch == 0xE0) {
+            // Extended key: arrows come as a prefix plus a scan code
+            switch (_getch()) {
+                case 72: keys.push_back(KEY_UP); break;
+                case 80: keys.push_back(KEY_DOWN); break;
+                case 75: keys.push_back(KEY_LEFT); break;
+                case 77: keys.push_back(KEY_RIGHT); break;
+                default: break;
+            }
+        } else if (ch == '\r') {
+            keys.push_back(KEY_ENTER);
+        } else if (ch == '\b') {
+            keys.push_back(KEY_BACKSPACE);
+        } else {
+            keys.push_back(ch);
+        }
+    }
+    if (keys.size() == before) {
+        // Other console events (focus, mouse) also wake the wait
+        FlushConsoleInputBuffer(input);
+    }
+#else
+    // Without a deadline of its own, an unfinished escape sequence waits
+    // ESCAPE_WAIT_MS for the rest of it before it is given up
+    long long start = steadyMs();
+    while (true) {
+        long long now = steadyMs();
+        long long wait = timeoutMs < 0 ? -1 : std::max(0LL, start + timeoutMs - now);
+        bool escapeDue = false;
+        if (!pending.empty()) {
+            long long escapeWait = std::max(0LL, pendingSinceMs + ESCAPE_WAIT_MS - now);
+            if (wait < 0 || escapeWait <= wait) {
+                wait = escapeWait;
+                escapeDue = true;
+            }
+        }
+
+        struct pollfd waiter;
+        waiter.fd = STDIN_FILENO;
+        waiter.events = POLLIN;
+        waiter.revents = 0;
+
+        int ready = ::poll(&waiter, 1, (int)wait);
+        if (ready < 0) {
+            return errno == EINTR ? 0 : -1;   // Interrupted by a signal (e.g. resize)
+        }
+        if (ready == 0) {
+            if (!escapeDue) {
+                return 0;
+            }
+            decodePending(true, keys);
+            if (keys.size() > before) {
+                break;
+            }
+            continue;
+        }
+
+        unsigned char buffer[256];
+        ssize_t length = ::read(STDIN_FILENO, buffer, sizeof(buffer));
+        if (length < 0) {
+            if (errno == EINTR || errno == EAGAIN) {
+                return 0;
+            }
+            return -1;
+        }
+        if (length == 0) {
+            return -1;                        // End of input
+        }
+
+        if (pending.empty()) {
+            pendingSinceMs = steadyMs();
+        }
+        pending.insert(pending.end(), buffer, buffer + length);
+        decodePending(false, keys);
+        if (keys.size() > before) {
+            break;
+        }
+    }
+#endif
+
+    return (int)(keys.size() - before);
+}
+
+#ifndef _WIN32
+/**
+ * Decode queued bytes into keys
+ * CSI sequences (ESC [ parameters final) are consumed up to their final
+ * byte, so keys like Delete (ESC [ 3 ~) leave nothing behind; only the
+ * arrows (with or without modifiers) become keys. An unfinished sequence
+ * at the end stays queued unless flushing, where a lone ESC becomes Esc
+ */
+void RawTerminal::decodePending(bool flush, std::vector<int>& keys) {
+    size_t length = pending.size();
+    size_t i = 0;
+
+    while (i < length) {
+        unsigned char ch = pending[i];
+
+        if (ch == 0x1B) {
+            if (i + 1 == length) {
+                if (!flush) break;            // Maybe the start of a sequence
+                keys.push_back(KEY_ESCAPE);
+                i++;
+                continue;
+            }
+
+            unsigned char kind = pending[i + 1];
+            if (kind == 'O') {
+                // SS3: exactly one more byte (arrows in application mode)
+                if (i + 2 == length) {
+                    if (!flush) break;
+                    i = length;
+                    continue;
+                }
+                int key = arrowKey(pending[i + 2]);
+                if (key != 0) keys.push_back(key);
+                i += 3;
+                continue;
+            }
+            if (kind == '[') {
+                // CSI: parameter / intermediate bytes, then a final byte
+                size_t j = i + 2;
+                while (j < length && pending[j] >= 0x20 && pending[j] <= 0x3F) {
+                    j++;
+                }
+                if (j == length) {
+                    if (!flush && j - i < MAX_SEQUENCE_BYTES) break;
+                    i = length;               // Never finished, drop it
+                    continue;
+                }
+                if (pending[j] >= 0x40 && pending[j] <= 0x7E) {
+                    int key = arrowKey(pending[j]);
+                    if (key != 0) keys.push_back(key);
+                    i = j + 1;
+                } else {
+                    i = j;                    // Malformed, resume at the odd byte
+                }
+                continue;
+            }
+
+            // ESC followed by anything else is the Esc key itself
+            keys.push_back(KEY_ESCAPE);
+            i++;
+            continue;
+        }
+
+        if (ch == '\r') {
+            keys.push_back(KEY_ENTER);
+        } else if (ch == '\b') {
+            keys.push_back(KEY_BACKSPACE);
+        } else {
+            keys.push_back(ch);
+        }
+        i++;
+    }
+
+    pending.erase(pending.begin(), pending.begin() + i);
+    if (!pending.empty() && i > 0) {
+        pendingSinceMs = steadyMs();
+    }
+}
+#endif
@@ -0,0 +1,78 @@
+#ifndef RAW_TERMINAL_H
+#define RAW_TERMINAL_H
+
+#include <vector>
+#include <cstddef>
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <termios.h>
+#endif
+
+/**
+ * RawTerminal class
+ * Keeps stdin in raw mode (no line buffering, no echo) for as long as the
+ * object lives and restores the saved mode on destruction, so keys arrive
+ * as they are pressed without Enter. readKeys() sleeps in poll() until a
+ * key arrives or the timeout expires, then takes everything queued with a
+ * single read; nothing is toggled per call and an idle game makes no
+ * system calls between ticks. Escape sequences split across reads are kept
+ * until they complete; a lone ESC is reported once nothing follows it
+ * within ESCAPE_WAIT_MS
+ * Member: 6 - Utility + Display
+ */
+class RawTerminal {
+public:
+    // Non-character keys (above the byte range)
+    static constexpr int KEY_UP = 0x100;
+    static constexpr int KEY_DOWN = 0x101;
+    static constexpr int KEY_LEFT = 0x102;
+    static constexpr int KEY_RIGHT = 0x103;
+    static constexpr int KEY_ESCAPE = 0x1B;
+    static constexpr int KEY_ENTER = '\n';
+    static constexpr int KEY_BACKSPACE = 0x7F;
+    static constexpr int KEY_INTERRUPT = 0x03;   // Ctrl+C (not a signal in raw mode)
+
+    // How long an ESC waits for the rest of a sequence before it counts as Esc
+    static constexpr int ESCAPE_WAIT_MS = 50;
+
+private:
+    bool active;
+#ifdef _WIN32
+    HANDLE input;
+    DWORD savedMode;
+#else
+    struct termios savedMode;
+
+    // Bytes of an escape sequence still waiting for the rest of it
+    std::vector<unsigned char> pending;
+    long long pendingSinceMs;
+
+    // Decode complete keys from the front of pending, keeping an unfinished
+    // escape sequence (or, when flushing, giving it up)
+    void decodePending(bool flush, std::vector<int>& keys);
+#endif
+
+public:
+    // Constructor: Enter raw mode if stdin is a terminal
+    RawTerminal();
+
+    // Destructor: Restore the saved mode
+    ~RawTerminal();
+
+    RawTerminal(const RawTerminal&) = delete;
+    RawTerminal& operator=(const RawTerminal&) = delete;
+
+    // Restore the saved mode early (safe to call more than once)
+    void restore();
+
+    // True while raw mode is on (false when stdin isn't a terminal)
+    bool isActive() const;
+
+    // Wait up to timeoutMs for input and append every queued key to keys
+    // Returns the number of keys read (0 on timeout), -1 once input is closed
+    int readKeys(int timeoutMs, std::vector<int>& keys);
+};
+
+#endif // RAW_TERMINAL_H
@@ -0,0 +1,116 @@
+#include "RenderThread.h"
+
+/**
+ * Constructor: Start the render thread
+ */
+RenderThread::RenderThread(Telemetry& telemetry)
+    : telemetry(telemetry), pending(false), stopping(false),
+      redrawPending(false), published(0), drawn(0), skipped(0) {
+    worker = std::thread(&RenderThread::run, this);
+}
+
+/**
+ * Destructor: Stop the render thread
+ */
+RenderThread::~RenderThread() {
+    stop();
+}
+
+/**
+ * Get the snapshot to fill next
+ */
+RenderThread::Snapshot& RenderThread::nextSnapshot() {
+    return frames.writeSlot();
+}
+
+/**
+ * Publish the filled snapshot and wake the render thread
+ */
+void RenderThread::publish() {
+    // Kept outside the snapshot so it survives the snapshot being skipped
+    if (frames.writeSlot().frame.fullRedraw) {
+        redrawPending.store(true, std::memory_order_release);
+    }
+    if (frames.publish()) {
+        skipped.fetch_add(1, std::memory_order_relaxed);
+    }
+    published.fetch_add(1, std::memory_order_relaxed);
+
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        pending = true;
+    }
+    wake.notify_one();
+}
+
+/**
+ * Draw the last published frame, then stop the thread
+ */
+void RenderThread::stop() {
+    if (!worker.joinable()) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        stopping = true;
+    }
+    wake.notify_one();
+    worker.join();
+}
+
+/**
+ * Render thread: sleep until something is published, draw the newest
+ */
+void RenderThread::run() {
+    while (true) {
+        bool exiting;
+        {
+            std::unique_lock<std::mutex> lock(wakeMutex);
+            wake.wait(lock, [this]() { return pending || stopping; });
+            pending = false;
+            exiting = stopping;
+        }
+
+        // Older snapshots were replaced in the buffer; only the newest is drawn
+        if (frames.take()) {
+            const Snapshot& snapshot = frames.readSlot();
+            if (redrawPending.exchange(false, std::memory_order_acq_rel)) {
+                renderer.invalidate();
+            }
+
+            int64_t frameStart = Telemetry::now();
+            renderer.present(snapshot.frame);
+            telemetry.recordSince(Telemetry::Metric::FRAME_TIME, frameStart);
+            if (snapshot.inputTime >= 0) {
+                telemetry.recordSince(Telemetry::Metric::MOVE_LATENCY, snapshot.inputTime);
+            }
+            drawn.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        if (exiting) {
+            break;
+        }
+    }
+}
+
+/**
+ * Get number of frames published
+ */
+long long RenderThread::getPublishedCount() const {
+    return published.load(std::memory_order_relaxed);
+}
+
+/**
+ * Get number of frames drawn
+ */
+long long RenderThread::getDrawnCount() const {
+    return drawn.load(std::memory_order_relaxed);
+}
+
+/**
+ * Get number of frames replaced before they were drawn
+ */
+long long RenderThread::getSkippedCount() const {
+    return skipped.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,76 @@
+#ifndef RENDER_THREAD_H
+#define RENDER_THREAD_H
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <cstdint>
+#include "FrameRenderer.h"
+#include "TripleBuffer.h"
+#include "Telemetry.h"
+
+/**
+ * RenderThread class
+ * Draws frames on a thread of its own so terminal writes never hold up
+ * the game loop. The game thread composes a frame snapshot and publishes
+ * it through a lock-free triple buffer; the render thread always draws the
+ * newest snapshot and frames replaced before it got to them are skipped
+ * The mutex / condition variable only put the idle render thread to sleep,
+ * they are never held across terminal I/O
+ * Frame time and move latency are recorded on the render thread (each
+ * Telemetry metric must only be written by one thread)
+ * Member: 6 - Utility + Display
+ */
+class RenderThread {
+public:
+    // One published frame
+    struct Snapshot {
+        FrameRenderer::Frame frame;
+        int64_t inputTime;      // Telemetry::now() of the keys it shows, -1 if none
+    };
+
+private:
+    TripleBuffer<Snapshot> frames;
+    FrameRenderer renderer;     // Render thread only
+    Telemetry& telemetry;
+
+    std::thread worker;
+    std::mutex wakeMutex;
+    std::condition_variable wake;
+    bool pending;               // Guarded by wakeMutex
+    bool stopping;              // Guarded by wakeMutex
+
+    std::atomic<bool> redrawPending;    // A full redraw was asked for, maybe by a skipped frame
+    std::atomic<long long> published;
+    std::atomic<long long> drawn;
+    std::atomic<long long> skipped;
+
+    void run();
+
+public:
+    // Constructor: start the render thread
+    explicit RenderThread(Telemetry& telemetry);
+
+    // Destructor: stop (drawing the last published frame)
+    ~RenderThread();
+
+    RenderThread(const RenderThread&) = delete;
+    RenderThread& operator=(const RenderThread&) = delete;
+
+    // Game thread: the snapshot to fill next
+    Snapshot& nextSnapshot();
+
+    // Game thread: hand the filled snapshot to the render thread (never blocks on I/O)
+    void publish();
+
+    // Draw whatever was published last, then stop the thread
+    void stop();
+
+    // Counters
+    long long getPublishedCount() const;
+    long long getDrawnCount() const;
+    long long getSkippedCount() const;
+};
+
+#endif // RENDER_THREAD_H
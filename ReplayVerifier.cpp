@@ -0,0 +1,204 @@
+#include "ReplayVerifier.h"
+#include "MazeGenerator.h"
+#include "Player.h"
+#include "PathSearch.h"
+#include "GameManager.h"
+#include <sstream>
+#include <fstream>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <cstdlib>
+
+/**
+ * Verify one replay by re-simulating it from scratch
+ */
+ReplayVerifier::Verdict ReplayVerifier::verify(const ReplayRecord& replay, int* expectedScore) {
+    if (replay.size < MIN_SIZE || replay.size > MAX_SIZE ||
+        replay.timeTakenMs < 0 || replay.moves.empty()) {
+        return Verdict::BAD_PARAMETERS;
+    }
+
+    MazeGenerator maze(replay.size, replay.size);
+    maze.generateMaze(replay.seed);
+
+    std::pair<int, int> start = maze.getStartPosition();
+    std::pair<int, int> exit = maze.getExitPosition();
+
+    // The game only records moves (and undo / redo / rewind steps) that
+    // succeeded, and stops at the first move onto the exit; runs of moves
+    // between them go through the fast batch path, and a rewind (t<step>)
+    // is one rewindTo call
+    Player player;
+    player.initialize(start.first, start.second);
+    const std::string& keys = replay.moves;
+    bool reachedExit = false;
+    size_t i = 0;
+    while (i < keys.size()) {
+        if (reachedExit) {
+            return Verdict::INVALID_MOVES;
+        }
+        if (keys[i] == 'u' || keys[i] == 'r') {
+            if (!(keys[i] == 'u' ? player.undo(maze) : player.redo(maze))) {
+                return Verdict::INVALID_MOVES;
+            }
+            i++;
+            continue;
+        }
+        if (keys[i] == 't') {
+            size_t digits = keys.find_first_not_of("0123456789", i + 1);
+            if (digits == std::string::npos) {
+                digits = keys.size();
+            }
+            if (digits == i + 1 || digits - i > 10 ||
+                !player.rewindTo(std::atoi(keys.c_str() + i + 1), maze)) {
+                return Verdict::INVALID_MOVES;
+            }
+            i = digits;
+            continue;
+        }
+
+        size_t end = std::min(keys.size(), keys.find_first_of("urt", i));
+        Player::MoveBatchResult result = player.applyMoves(keys.data() + i, end - i, maze, true);
+        if (result.blocked > 0) {
+            return Verdict::INVALID_MOVES;
+        }
+        if (result.exitIndex >= 0) {
+            if (i + (size_t)result.exitIndex != end - 1) {
+                return Verdict::INVALID_MOVES;
+            }
+            reachedExit = true;
+        }
+        i = end;
+    }
+    if (!reachedExit) {
+        return Verdict::EXIT_NOT_REACHED;
+    }
+
+    PathSearch search(PathSearch::Algorithm::BFS, start.first, start.second,
+                      exit.first, exit.second, maze);
+    search.run();
+    int shortestPathLength = (int)search.getPath().size() - 1;
+
+    int score = GameManager::computeScore(player.getActionCount(), replay.timeTakenMs,
+                                          shortestPathLength, replay.scoreVersion);
+    if (expectedScore) {
+        *expectedScore = score;
+    }
+
+    return score == replay.claimedScore ? Verdict::VALID : Verdict::SCORE_MISMATCH;
+}
+
+/**
+ * Verify a batch in parallel
+ * Workers pull small blocks of replays from a shared counter, so uneven
+ * replay lengths still balance across threads
+ */
+std::vector<ReplayVerifier::Verdict> ReplayVerifier::verifyBatch(
+    const std::vector<ReplayRecord>& replays, int threadCount) {
+
+    std::vector<Verdict> verdicts(replays.size(), Verdict::BAD_PARAMETERS);
+    if (threadCount <= 0) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    const size_t BLOCK = 16;
+    std::atomic<size_t> next(0);
+
+    auto worker = [&]() {
+        while (true) {
+            size_t begin = next.fetch_add(BLOCK);
+            if (begin >= replays.size()) break;
+            size_t end = std::min(replays.size(), begin + BLOCK);
+            for (size_t i = begin; i < end; i++) {
+                verdicts[i] = verify(replays[i]);
+            }
+        }
+    };
+
+    size_t threads = std::min((size_t)threadCount, (replays.size() + BLOCK - 1) / BLOCK);
+    std::vector<std::thread> workers;
+    for (size_t t = 1; t < threads; t++) {
+        workers.emplace_back(worker);
+    }
+    worker();
+
+    for (auto& thread : workers) {
+        thread.join();
+    }
+
+    return verdicts;
+}
+
+/**
+ * Format a replay as one line
+ */
+std::string ReplayVerifier::format(const ReplayRecord& replay) {
+    std::ostringstream oss;
+    oss << "v" << replay.scoreVersion << " " << replay.playerName << " " << replay.seed << " " << replay.size << " "
+        << replay.timeTakenMs << " " << replay.claimedScore << " " << replay.moves;
+    return oss.str();
+}
+
+/**
+ * Parse one replay line, returns false if it is malformed
+ * A line that doesn't parse with a version tag is tried as an untagged
+ * version 1 line (a player may be called "v2")
+ */
+bool ReplayVerifier::parse(const std::string& line, ReplayRecord& replay) {
+    std::istringstream tagged(line);
+    std::string tag;
+    if (tagged >> tag && tag.size() > 1 && tag[0] == 'v' &&
+        tag.find_first_not_of("0123456789", 1) == std::string::npos &&
+        tagged >> replay.playerName >> replay.seed >> replay.size
+               >> replay.timeTakenMs >> replay.claimedScore >> replay.moves) {
+        replay.scoreVersion = std::atoi(tag.c_str() + 1);
+        return replay.scoreVersion >= 1 && replay.scoreVersion <= ReplayRecord::SCORE_VERSION;
+    }
+
+    std::istringstream iss(line);
+    replay.scoreVersion = 1;
+    return (bool)(iss >> replay.playerName >> replay.seed >> replay.size
+                      >> replay.timeTakenMs >> replay.claimedScore >> replay.moves);
+}
+
+/**
+ * Load every well-formed replay from a file
+ * Line numbers count every line, so they match the file even when some
+ * lines are skipped
+ */
+std::vector<ReplayRecord> ReplayVerifier::loadFile(const std::string& path,
+                                                   std::vector<size_t>* malformedLines) {
+    std::vector<ReplayRecord> replays;
+    std::ifstream file(path);
+
+    std::string line;
+    ReplayRecord replay;
+    size_t lineNumber = 0;
+    while (std::getline(file, line)) {
+        lineNumber++;
+        if (parse(line, replay)) {
+            replay.line = lineNumber;
+            replays.push_back(replay);
+        } else if (malformedLines &&
+                   line.find_first_not_of(" \t\r") != std::string::npos) {
+            malformedLines->push_back(lineNumber);
+        }
+    }
+
+    return replays;
+}
+
+/**
+ * Get verdict name
+ */
+const char* ReplayVerifier::verdictName(Verdict verdict) {
+    switch (verdict) {
+        case Verdict::VALID:            return "valid";
+        case Verdict::BAD_PARAMETERS:   return "bad_parameters";
+        case Verdict::INVALID_MOVES:    return "invalid_moves";
+        case Verdict::EXIT_NOT_REACHED: return "exit_not_reached";
+        case Verdict::SCORE_MISMATCH:   return "score_mismatch";
+    }
+    return "unknown";
+}
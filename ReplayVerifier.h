@@ -0,0 +1,68 @@
+#ifndef REPLAY_VERIFIER_H
+#define REPLAY_VERIFIER_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+// A finished Classic run: everything needed to re-simulate it
+struct ReplayRecord {
+    // Score scale: 1 = whole points (files written before millisecond
+    // scoring, stored without a version tag), 2 = thousandths of a point
+    static const int SCORE_VERSION = 2;
+    
+    std::string playerName;
+    uint32_t seed;          // MazeGenerator seed
+    int size;               // Maze size as entered (width = height)
+    long long timeTakenMs;  // Milliseconds, as passed to endGame
+    int claimedScore;
+    std::string moves;      // w/a/s/d moves, u/r undo / redo steps and t<step> rewinds, start to exit
+    size_t line = 0;        // 1-based line in the file it was loaded from, 0 if none
+    int scoreVersion = SCORE_VERSION;
+};
+
+/**
+ * ReplayVerifier class
+ * Headless check of submitted runs: regenerates the maze from the seed,
+ * re-simulates the moves with Player::applyMoves (undo / redo steps with
+ * Player::undo / redo, rewinds with Player::rewindTo), finds the shortest
+ * path and recomputes the endGame score from the steps charged. No terminal, no shared state, so large
+ * batches are verified in parallel, one replay per task
+ * Member: 4 - Scoring system
+ */
+class ReplayVerifier {
+public:
+    enum class Verdict {
+        VALID,
+        BAD_PARAMETERS,     // Size / time / moves out of range
+        INVALID_MOVES,      // A move walks into a wall or past the exit
+        EXIT_NOT_REACHED,
+        SCORE_MISMATCH
+    };
+
+    static const int MIN_SIZE = 5;
+    static const int MAX_SIZE = 4001;
+
+    // Verify one replay; expectedScore (optional) receives the recomputed score
+    static Verdict verify(const ReplayRecord& replay, int* expectedScore = nullptr);
+
+    // Verify many replays across threadCount threads (0 = all cores)
+    static std::vector<Verdict> verifyBatch(const std::vector<ReplayRecord>& replays,
+                                            int threadCount = 0);
+
+    // One replay per line: v<score version> name seed size time score moves
+    // Lines without the version tag are read as version 1
+    static std::string format(const ReplayRecord& replay);
+    static bool parse(const std::string& line, ReplayRecord& replay);
+
+    // Read every well-formed line of a replay file, each tagged with its line
+    // number; malformedLines (optional) receives the numbers of the
+    // non-blank lines that could not be parsed
+    static std::vector<ReplayRecord> loadFile(const std::string& path,
+                                              std::vector<size_t>* malformedLines = nullptr);
+
+    // Human readable verdict
+    static const char* verdictName(Verdict verdict);
+};
+
+#endif // REPLAY_VERIFIER_H
@@ -0,0 +1,212 @@
+#include "RoutePlanner.h"
+#include <algorithm>
+#include <limits>
+#include <cstdint>
+
+const int RoutePlanner::UNREACHABLE = std::numeric_limits<int>::max() / 4;
+
+/**
+ * Constructor: Allocate BFS scratch once for the maze size
+ */
+RoutePlanner::RoutePlanner(const MazeGenerator& maze)
+    : maze(&maze), width(maze.getWidth()), height(maze.getHeight()),
+      routeLength(UNREACHABLE), stampCounter(0) {
+    cellTarget.assign(width * height, -1);
+    visitStamp.assign(width * height, 0);
+    cellDistance.assign(width * height, 0);
+    queue.reserve(width * height);
+}
+
+/**
+ * BFS from one point, stopping as soon as every other point has been reached
+ * The visit stamp avoids clearing the scratch arrays between passes
+ */
+void RoutePlanner::bfsFrom(int source, int stamp) {
+    int pointCount = points.size();
+    int* row = &distances[source * pointCount];
+    std::fill(row, row + pointCount, UNREACHABLE);
+
+    int sourceCell = points[source].second * width + points[source].first;
+    if (!maze->isValidPath(points[source].first, points[source].second)) {
+        return;
+    }
+
+    queue.clear();
+    queue.push_back(sourceCell);
+    visitStamp[sourceCell] = stamp;
+    cellDistance[sourceCell] = 0;
+
+    int remaining = pointCount;
+
+    // Directions: up, down, left, right
+    const int dx[] = {0, 0, -1, 1};
+    const int dy[] = {-1, 1, 0, 0};
+
+    for (size_t head = 0; head < queue.size() && remaining > 0; head++) {
+        int current = queue[head];
+
+        // Only point cells need the scan (several points may share a cell)
+        if (cellTarget[current] != -1) {
+            for (int p = 0; p < pointCount; p++) {
+                if (row[p] == UNREACHABLE &&
+                    points[p].second * width + points[p].first == current) {
+                    row[p] = cellDistance[current];
+                    remaining--;
+                }
+            }
+        }
+
+        int x = current % width;
+        int y = current / width;
+        for (int i = 0; i < 4; i++) {
+            int nx = x + dx[i];
+            int ny = y + dy[i];
+            if (nx < 0 || nx >= width || ny < 0 || ny >= height) continue;
+
+            int next = ny * width + nx;
+            if (visitStamp[next] != stamp && maze->isValidPath(nx, ny)) {
+                visitStamp[next] = stamp;
+                cellDistance[next] = cellDistance[current] + 1;
+                queue.push_back(next);
+            }
+        }
+    }
+}
+
+/**
+ * Compute the optimal route with Held-Karp
+ * dp[mask][i] = shortest walk from start that collects exactly the items in
+ * mask and ends on item i. Transitions only iterate the set bits we need,
+ * and the path is recovered from the table itself so no parent table is kept
+ */
+int RoutePlanner::planRoute(std::pair<int, int> start,
+                            const std::vector<std::pair<int, int>>& items,
+                            std::pair<int, int> exit) {
+    int itemCount = std::min((int)items.size(), MAX_ITEMS);
+
+    points.clear();
+    points.push_back(start);
+    points.insert(points.end(), items.begin(), items.begin() + itemCount);
+    points.push_back(exit);
+
+    int pointCount = points.size();
+    int exitIndex = pointCount - 1;
+    distances.assign(pointCount * pointCount, UNREACHABLE);
+
+    // K + 2 early-exit BFS passes fill the distance matrix
+    for (int p = 0; p < pointCount; p++) {
+        cellTarget[points[p].second * width + points[p].first] = p;
+    }
+    for (int p = 0; p < pointCount; p++) {
+        bfsFrom(p, ++stampCounter);
+    }
+    for (int p = 0; p < pointCount; p++) {
+        cellTarget[points[p].second * width + points[p].first] = -1;
+    }
+
+    order.clear();
+
+    // No items: route is just start -> exit
+    if (itemCount == 0) {
+        routeLength = distances[0 * pointCount + exitIndex];
+        return routeLength;
+    }
+
+    // Item i (0-based) is point i + 1
+    auto dist = [&](int from, int to) { return distances[from * pointCount + to]; };
+
+    uint32_t fullMask = (1u << itemCount) - 1;
+    std::vector<int> dp((size_t)(fullMask + 1) * itemCount, UNREACHABLE);
+
+    for (int i = 0; i < itemCount; i++) {
+        dp[((size_t)1 << i) * itemCount + i] = dist(0, i + 1);
+    }
+
+    for (uint32_t mask = 1; mask <= fullMask; mask++) {
+        const int* row = &dp[(size_t)mask * itemCount];
+        uint32_t notInMask = fullMask & ~mask;
+        if (notInMask == 0) continue;
+
+        for (uint32_t bits = mask; bits; bits &= bits - 1) {
+            int i = __builtin_ctz(bits);
+            int base = row[i];
+            if (base >= UNREACHABLE) continue;
+
+            const int* fromRow = &distances[(i + 1) * pointCount + 1];
+            for (uint32_t rest = notInMask; rest; rest &= rest - 1) {
+                int j = __builtin_ctz(rest);
+                if (fromRow[j] >= UNREACHABLE) continue;
+
+                int candidate = base + fromRow[j];
+                int& target = dp[(size_t)(mask | (1u << j)) * itemCount + j];
+                if (candidate < target) {
+                    target = candidate;
+                }
+            }
+        }
+    }
+
+    // Close the tour at the exit
+    routeLength = UNREACHABLE;
+    int last = -1;
+    for (int i = 0; i < itemCount; i++) {
+        int toExit = dist(i + 1, exitIndex);
+        int total = dp[(size_t)fullMask * itemCount + i];
+        if (total < UNREACHABLE && toExit < UNREACHABLE && total + toExit < routeLength) {
+            routeLength = total + toExit;
+            last = i;
+        }
+    }
+
+    if (last == -1) {
+        return routeLength;
+    }
+
+    // Walk the table backwards to recover the visiting order
+    uint32_t mask = fullMask;
+    int current = last;
+    while (true) {
+        order.push_back(current);
+        uint32_t prevMask = mask & ~(1u << current);
+        if (prevMask == 0) break;
+
+        int value = dp[(size_t)mask * itemCount + current];
+        for (uint32_t bits = prevMask; bits; bits &= bits - 1) {
+            int j = __builtin_ctz(bits);
+            int prev = dp[(size_t)prevMask * itemCount + j];
+            if (prev < UNREACHABLE && prev + dist(j + 1, current + 1) == value) {
+                current = j;
+                break;
+            }
+        }
+        mask = prevMask;
+    }
+    std::reverse(order.begin(), order.end());
+
+    return routeLength;
+}
+
+/**
+ * Get distance between two points of the last plan
+ */
+int RoutePlanner::getDistance(int from, int to) const {
+    int pointCount = points.size();
+    if (from < 0 || from >= pointCount || to < 0 || to >= pointCount) {
+        return UNREACHABLE;
+    }
+    return distances[from * pointCount + to];
+}
+
+/**
+ * Get optimal item visiting order
+ */
+std::vector<int> RoutePlanner::getItemOrder() const {
+    return order;
+}
+
+/**
+ * Get length of the last planned route
+ */
+int RoutePlanner::getRouteLength() const {
+    return routeLength;
+}
@@ -0,0 +1,60 @@
+#ifndef ROUTE_PLANNER_H
+#define ROUTE_PLANNER_H
+
+#include <vector>
+#include <utility>
+#include "MazeGenerator.h"
+
+/**
+ * RoutePlanner class
+ * Optimal pickup order for collectibles: start -> every item -> exit
+ * Builds a pairwise distance matrix with one early-exit BFS per point
+ * (K + 2 passes) and runs Held-Karp bitmask DP over it
+ * Uses Queue (BFS) and Dynamic Programming over subsets
+ * Member: 3 - Pathfinding algorithms
+ */
+class RoutePlanner {
+private:
+    const MazeGenerator* maze;
+    int width;
+    int height;
+
+    // Points: 0 = start, 1..K = items, K + 1 = exit
+    std::vector<std::pair<int, int>> points;
+    std::vector<int> distances;          // Flat (K + 2) x (K + 2) matrix
+    std::vector<int> order;              // Optimal visiting order (item indices)
+    int routeLength;
+
+    // BFS scratch, reused between passes
+    std::vector<int> cellTarget;         // Point index at a cell, -1 if none
+    std::vector<int> visitStamp;         // Pass number that last reached a cell
+    std::vector<int> cellDistance;
+    std::vector<int> queue;
+    int stampCounter;
+
+    void bfsFrom(int source, int stamp);
+
+public:
+    static constexpr int MAX_ITEMS = 20;
+    static const int UNREACHABLE;
+
+    // Constructor
+    explicit RoutePlanner(const MazeGenerator& maze);
+
+    // Compute the shortest route from start through all items to exit
+    // Returns route length in moves, or UNREACHABLE
+    int planRoute(std::pair<int, int> start,
+                  const std::vector<std::pair<int, int>>& items,
+                  std::pair<int, int> exit);
+
+    // Distance between two points (indices as described above)
+    int getDistance(int from, int to) const;
+
+    // Optimal visiting order as indices into the items vector
+    std::vector<int> getItemOrder() const;
+
+    // Length of the last planned route
+    int getRouteLength() const;
+};
+
+#endif // ROUTE_PLANNER_H
@@ -0,0 +1,334 @@
+#include "ScoreJournal.h"
+#include "LeaderboardFile.h"
+#include <fstream>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+#include <algorithm>
+
+#ifdef _WIN32
+    #include <io.h>
+#else
+    #include <unistd.h>
+    #include <fcntl.h>
+#endif
+
+namespace {
+
+// Journal record header: checksum, score, name length (name bytes follow)
+const size_t HEADER_BYTES = 4 + 4 + 2;
+const size_t MAX_NAME_BYTES = 0xFFFF;
+
+/**
+ * FNV-1a checksum over score, length and name
+ */
+uint32_t recordChecksum(const char* body, size_t length) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= (unsigned char)body[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * Flush a stdio stream all the way to the disk
+ */
+void syncFile(std::FILE* file) {
+    std::fflush(file);
+#ifdef _WIN32
+    _commit(_fileno(file));
+#else
+    fsync(fileno(file));
+#endif
+}
+
+/**
+ * Make a rename durable by syncing the directory that holds the file
+ */
+void syncParentDirectory(const std::string& path) {
+#ifndef _WIN32
+    std::string directory = std::filesystem::path(path).parent_path().string();
+    int fd = ::open(directory.empty() ? "." : directory.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        fsync(fd);
+        ::close(fd);
+    }
+#else
+    (void)path;
+#endif
+}
+
+} // namespace
+
+/**
+ * Constructor: Nothing is opened until recover() / the first write
+ */
+ScoreJournal::ScoreJournal(const std::string& snapshotPath, const std::string& journalPath)
+    : snapshotPath(snapshotPath), journalPath(journalPath), journal(nullptr),
+      stopping(false), busy(false), journalRecords(0) {
+}
+
+/**
+ * Destructor: Drain the queue and stop the writer
+ */
+ScoreJournal::~ScoreJournal() {
+    close();
+}
+
+/**
+ * Read every intact journal record
+ */
+std::vector<ScoreJournal::Entry> ScoreJournal::recover() {
+    std::vector<Entry> entries;
+
+    std::ifstream input(journalPath, std::ios::binary);
+    if (!input.is_open()) {
+        journalRecords = 0;
+        return entries;
+    }
+
+    long long records = 0;
+    std::streamoff validBytes = 0;
+    bool torn = false;
+    std::vector<char> body;
+
+    while (true) {
+        char header[HEADER_BYTES];
+        if (!input.read(header, HEADER_BYTES)) {
+            torn = input.gcount() > 0;
+            break;
+        }
+
+        uint32_t checksum;
+        int32_t score;
+        uint16_t length;
+        std::memcpy(&checksum, header, 4);
+        std::memcpy(&score, header + 4, 4);
+        std::memcpy(&length, header + 8, 2);
+
+        body.assign(header + 4, header + HEADER_BYTES);
+        body.resize(6 + (size_t)length);
+        if (!input.read(body.data() + 6, length) ||
+            recordChecksum(body.data(), body.size()) != checksum) {
+            torn = true;
+            break;
+        }
+
+        entries.push_back(std::make_pair(std::string(body.data() + 6, length), (int)score));
+        validBytes += (std::streamoff)(HEADER_BYTES + length);
+        records++;
+    }
+    input.close();
+
+    // Cut a partially written tail so new records follow intact ones
+    if (torn) {
+        std::error_code error;
+        std::filesystem::resize_file(journalPath, (uintmax_t)validBytes, error);
+    }
+
+    journalRecords = records;
+    return entries;
+}
+
+/**
+ * Open the journal for appending and start the writer thread
+ * Appends arrive from several threads, so only the first one starts it
+ */
+bool ScoreJournal::startWriter() {
+    std::lock_guard<std::mutex> start(writerMutex);
+    if (writer.joinable()) {
+        return true;
+    }
+
+    journal = std::fopen(journalPath.c_str(), "ab");
+    if (!journal) {
+        return false;
+    }
+
+    stopping = false;
+    writer = std::thread(&ScoreJournal::writerLoop, this);
+    return true;
+}
+
+/**
+ * Queue one score update
+ */
+void ScoreJournal::append(const std::string& playerName, int score) {
+    if (!startWriter()) {
+        return;
+    }
+
+    Job job;
+    job.compact = false;
+    job.entry = std::make_pair(playerName.substr(0, MAX_NAME_BYTES), score);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pending.push_back(std::move(job));
+    }
+    wake.notify_one();
+    journalRecords++;
+}
+
+/**
+ * Check if the journal is due for compaction
+ */
+bool ScoreJournal::needsCompaction() const {
+    return journalRecords >= COMPACT_RECORDS;
+}
+
+/**
+ * Queue a compaction behind every update queued so far
+ */
+void ScoreJournal::compact(std::vector<Entry> updates) {
+    if (!startWriter()) {
+        return;
+    }
+
+    Job job;
+    job.compact = true;
+    job.updates = std::move(updates);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pending.push_back(std::move(job));
+    }
+    wake.notify_one();
+    journalRecords = 0;
+}
+
+/**
+ * Wait until the writer has nothing queued or in flight
+ */
+void ScoreJournal::flush() {
+    std::unique_lock<std::mutex> lock(mutex);
+    idle.wait(lock, [this]() { return pending.empty() && !busy; });
+}
+
+/**
+ * Drain the queue and stop the writer
+ */
+void ScoreJournal::close() {
+    std::lock_guard<std::mutex> stop(writerMutex);
+    if (!writer.joinable()) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_one();
+    writer.join();
+
+    std::fclose(journal);
+    journal = nullptr;
+}
+
+/**
+ * Writer thread: take everything queued, write it in order, then sync once
+ */
+void ScoreJournal::writerLoop() {
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (true) {
+        wake.wait(lock, [this]() { return stopping || !pending.empty(); });
+        if (pending.empty()) {
+            break;
+        }
+
+        std::vector<Job> batch;
+        batch.swap(pending);
+        busy = true;
+        lock.unlock();
+
+        bool dirty = false;
+        for (const Job& job : batch) {
+            if (job.compact) {
+                writeSnapshot(job.updates);
+                dirty = false;
+            } else {
+                writeRecord(job.entry);
+                dirty = true;
+            }
+        }
+        if (dirty) {
+            syncJournal();
+        }
+
+        lock.lock();
+        busy = false;
+        idle.notify_all();
+    }
+}
+
+/**
+ * Append one checksummed record (buffered, synced per batch)
+ */
+void ScoreJournal::writeRecord(const Entry& entry) {
+    uint16_t length = (uint16_t)entry.first.size();
+    int32_t score = entry.second;
+
+    std::vector<char> record(HEADER_BYTES + length);
+    std::memcpy(record.data() + 4, &score, 4);
+    std::memcpy(record.data() + 8, &length, 2);
+    std::memcpy(record.data() + HEADER_BYTES, entry.first.data(), length);
+
+    uint32_t checksum = recordChecksum(record.data() + 4, record.size() - 4);
+    std::memcpy(record.data(), &checksum, 4);
+
+    std::fwrite(record.data(), 1, record.size(), journal);
+}
+
+/**
+ * Sync buffered journal records to disk
+ */
+void ScoreJournal::syncJournal() {
+    syncFile(journal);
+}
+
+/**
+ * Merge updates into the snapshot and replace it atomically, then start
+ * an empty journal
+ * A crash before the rename keeps the old snapshot plus the full journal;
+ * a crash after it replays a journal the snapshot already covers
+ */
+void ScoreJournal::writeSnapshot(const std::vector<Entry>& updates) {
+    syncJournal();
+
+    // Readers keep their own mapping of the old file, the rename
+    // doesn't disturb them
+    LeaderboardFile base;
+    base.open(snapshotPath);
+    std::vector<Entry> merged = LeaderboardFile::merge(base, updates);
+    base.close();
+
+    std::string tempPath = snapshotPath + ".tmp";
+    std::FILE* file = std::fopen(tempPath.c_str(), "wb");
+    if (!file) {
+        return;  // Keep journaling, the next compaction will retry
+    }
+
+    bool written = LeaderboardFile::write(file, merged);
+    syncFile(file);
+    std::fclose(file);
+    if (!written) {
+        std::remove(tempPath.c_str());
+        return;
+    }
+
+    std::error_code error;
+    std::filesystem::rename(tempPath, snapshotPath, error);
+    if (error) {
+        return;
+    }
+    syncParentDirectory(snapshotPath);
+
+    std::FILE* fresh = std::fopen(journalPath.c_str(), "wb");
+    if (fresh) {
+        syncFile(fresh);
+        std::fclose(journal);
+        journal = fresh;
+    }
+}
@@ -0,0 +1,93 @@
+#ifndef SCORE_JOURNAL_H
+#define SCORE_JOURNAL_H
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <cstdio>
+#include <cstdint>
+
+/**
+ * ScoreJournal class
+ * Durable score storage without rewriting everything on each update:
+ *  - snapshot: the binary leaderboard file (see LeaderboardFile)
+ *  - journal: append-only binary records of later updates, each with a
+ *    checksum so a torn write at the tail is detected and ignored
+ * Updates are queued in O(1) and a background writer appends them in
+ * batches with one fsync per batch. Compaction merges the updates into a
+ * fresh snapshot (temp file + fsync + rename) and then empties the
+ * journal; replaying a record twice is harmless because every player
+ * keeps their best score
+ * Member: 4 - Scoring system
+ */
+class ScoreJournal {
+public:
+    typedef std::pair<std::string, int> Entry;
+
+private:
+    // One queued job: a score update, or a compaction with the updates to merge
+    struct Job {
+        bool compact;
+        Entry entry;
+        std::vector<Entry> updates;
+    };
+
+    std::string snapshotPath;
+    std::string journalPath;
+
+    std::FILE* journal;
+    std::thread writer;
+    std::mutex writerMutex;     // Starting / stopping the writer (appends race to start it)
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable idle;
+    std::vector<Job> pending;
+    bool stopping;
+    bool busy;
+    std::atomic<long long> journalRecords;  // Records since the last compaction
+
+    // Writer thread body
+    void writerLoop();
+    void writeRecord(const Entry& entry);
+    void writeSnapshot(const std::vector<Entry>& updates);
+    void syncJournal();
+    bool startWriter();
+
+public:
+    // Records are compacted once the journal holds this many, which also
+    // bounds the work recover() does at startup
+    static constexpr long long COMPACT_RECORDS = 4096;
+
+    // Constructor / Destructor (destructor writes everything queued)
+    ScoreJournal(const std::string& snapshotPath, const std::string& journalPath);
+    ~ScoreJournal();
+
+    ScoreJournal(const ScoreJournal&) = delete;
+    ScoreJournal& operator=(const ScoreJournal&) = delete;
+
+    // Read every intact journal record, in order (apply with keep-best
+    // semantics on top of the snapshot); a torn tail is cut off
+    std::vector<Entry> recover();
+
+    // Queue one score update, returns immediately
+    void append(const std::string& playerName, int score);
+
+    // True once the journal is big enough to be worth compacting
+    bool needsCompaction() const;
+
+    // Queue a compaction; updates must include every append since the
+    // snapshot was written (the writer merges them into the snapshot file)
+    void compact(std::vector<Entry> updates);
+
+    // Block until everything queued is on disk
+    void flush();
+
+    // Stop the writer after draining the queue
+    void close();
+};
+
+#endif // SCORE_JOURNAL_H
@@ -0,0 +1,84 @@
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+/**
+ * SpscRing class template
+ * Fixed-capacity lock-free ring buffer for exactly one producer thread and
+ * one consumer thread. Capacity must be a power of two; indices run freely
+ * and are masked on access, so all Capacity slots are usable. Head and tail
+ * sit on separate cache lines and each side caches the other's index, so a
+ * push or pop normally touches no shared line at all
+ * Member: 5 - Game management
+ */
+template <typename T, size_t Capacity>
+class SpscRing {
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+    static_assert(std::is_trivially_copyable<T>::value, "SpscRing holds POD records only");
+
+private:
+    static const size_t MASK = Capacity - 1;
+
+    alignas(64) std::atomic<size_t> head;   // Next slot to write (producer)
+    size_t cachedTail;                      // Producer's view of tail
+    alignas(64) std::atomic<size_t> tail;   // Next slot to read (consumer)
+    size_t cachedHead;                      // Consumer's view of head
+    alignas(64) T slots[Capacity];
+
+public:
+    SpscRing() : head(0), cachedTail(0), tail(0), cachedHead(0) {}
+
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    /**
+     * Producer: append one record, returns false if the ring is full
+     */
+    bool tryPush(const T& item) {
+        size_t h = head.load(std::memory_order_relaxed);
+        if (h - cachedTail == Capacity) {
+            cachedTail = tail.load(std::memory_order_acquire);
+            if (h - cachedTail == Capacity) {
+                return false;
+            }
+        }
+        slots[h & MASK] = item;
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Consumer: copy up to maxCount records into out, returns how many
+     * Releases the whole batch with a single store
+     */
+    size_t popBatch(T* out, size_t maxCount) {
+        size_t t = tail.load(std::memory_order_relaxed);
+        if (cachedHead == t) {
+            cachedHead = head.load(std::memory_order_acquire);
+            if (cachedHead == t) {
+                return 0;
+            }
+        }
+        size_t count = cachedHead - t;
+        if (count > maxCount) {
+            count = maxCount;
+        }
+        for (size_t i = 0; i < count; i++) {
+            out[i] = slots[(t + i) & MASK];
+        }
+        tail.store(t + count, std::memory_order_release);
+        return count;
+    }
+
+    /**
+     * Either side: true when nothing is waiting to be consumed
+     */
+    bool empty() const {
+        return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+    }
+};
+
+#endif // SPSC_RING_H
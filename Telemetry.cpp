@@ -0,0 +1,204 @@
+#include "Telemetry.h"
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+
+/**
+ * Constructor: Empty histogram
+ */
+Telemetry::Histogram::Histogram() : counts(BUCKETS, 0), total(0), minValue(UINT64_MAX), maxValue(0), sum(0) {
+}
+
+/**
+ * Map a value to its bucket
+ * Below LINEAR_LIMIT the value is the bucket; above it the bucket is the
+ * octave (position of the leading one) plus the next SUB_BITS bits
+ */
+int Telemetry::Histogram::bucketOf(uint64_t value) {
+    if (value < (uint64_t)LINEAR_LIMIT) {
+        return (int)value;
+    }
+    int octave = 63 - __builtin_clzll(value);
+    int sub = (int)((value >> (octave - SUB_BITS)) & (SUB_COUNT - 1));
+    return LINEAR_LIMIT + (octave - SUB_BITS - 1) * SUB_COUNT + sub;
+}
+
+/**
+ * Representative (middle) value of a bucket
+ */
+uint64_t Telemetry::Histogram::bucketMidpoint(int bucket) {
+    if (bucket < LINEAR_LIMIT) {
+        return (uint64_t)bucket;
+    }
+    int octave = (bucket - LINEAR_LIMIT) / SUB_COUNT + SUB_BITS + 1;
+    int sub = (bucket - LINEAR_LIMIT) % SUB_COUNT;
+    uint64_t width = (uint64_t)1 << (octave - SUB_BITS);
+    return ((uint64_t)(SUB_COUNT + sub) << (octave - SUB_BITS)) + width / 2;
+}
+
+/**
+ * Record one value
+ */
+void Telemetry::Histogram::record(uint64_t nanoseconds) {
+    counts[bucketOf(nanoseconds)]++;
+    total++;
+    sum += nanoseconds;
+    if (nanoseconds < minValue) minValue = nanoseconds;
+    if (nanoseconds > maxValue) maxValue = nanoseconds;
+}
+
+/**
+ * Clear all counts
+ */
+void Telemetry::Histogram::reset() {
+    std::fill(counts.begin(), counts.end(), 0);
+    total = 0;
+    minValue = UINT64_MAX;
+    maxValue = 0;
+    sum = 0;
+}
+
+/**
+ * Get number of recorded values
+ */
+uint64_t Telemetry::Histogram::count() const {
+    return total;
+}
+
+/**
+ * Get smallest recorded value (exact)
+ */
+uint64_t Telemetry::Histogram::min() const {
+    return total == 0 ? 0 : minValue;
+}
+
+/**
+ * Get largest recorded value (exact)
+ */
+uint64_t Telemetry::Histogram::max() const {
+    return maxValue;
+}
+
+/**
+ * Get mean of recorded values (exact)
+ */
+double Telemetry::Histogram::mean() const {
+    return total == 0 ? 0.0 : (double)(sum / total);
+}
+
+/**
+ * Get value at a percentile by walking the cumulative counts
+ */
+uint64_t Telemetry::Histogram::percentile(double percent) const {
+    if (total == 0) {
+        return 0;
+    }
+
+    uint64_t target = (uint64_t)(percent / 100.0 * total + 0.5);
+    if (target < 1) target = 1;
+    if (target > total) target = total;
+
+    uint64_t seen = 0;
+    for (int bucket = 0; bucket < BUCKETS; bucket++) {
+        seen += counts[bucket];
+        if (seen >= target) {
+            uint64_t value = bucketMidpoint(bucket);
+            return std::min(std::max(value, minValue), maxValue);
+        }
+    }
+    return maxValue;
+}
+
+/**
+ * Record one duration (negative clock differences count as 0)
+ */
+void Telemetry::record(Metric metric, int64_t nanoseconds) {
+    histograms[(int)metric].record(nanoseconds < 0 ? 0 : (uint64_t)nanoseconds);
+}
+
+/**
+ * Record the time elapsed since a now() stamp
+ */
+void Telemetry::recordSince(Metric metric, int64_t startNs) {
+    record(metric, now() - startNs);
+}
+
+/**
+ * Get a metric's histogram
+ */
+const Telemetry::Histogram& Telemetry::get(Metric metric) const {
+    return histograms[(int)metric];
+}
+
+/**
+ * Clear all metrics
+ */
+void Telemetry::reset() {
+    for (Histogram& histogram : histograms) {
+        histogram.reset();
+    }
+}
+
+/**
+ * Write a summary table (milliseconds)
+ */
+void Telemetry::writeSummary(std::ostream& out) const {
+    const double MS = 1e6;
+
+    out << std::left << std::setw(14) << "Metric" << std::right
+        << std::setw(8) << "Count" << std::setw(10) << "Mean"
+        << std::setw(10) << "p50" << std::setw(10) << "p90"
+        << std::setw(10) << "p99" << std::setw(10) << "Max" << "  (ms)" << std::endl;
+
+    std::ios::fmtflags flags = out.flags();
+    std::streamsize precision = out.precision();
+    out << std::fixed << std::setprecision(3);
+
+    for (int i = 0; i < (int)Metric::COUNT; i++) {
+        const Histogram& histogram = histograms[i];
+        out << std::left << std::setw(14) << metricName((Metric)i) << std::right
+            << std::setw(8) << histogram.count()
+            << std::setw(10) << histogram.mean() / MS
+            << std::setw(10) << histogram.percentile(50) / MS
+            << std::setw(10) << histogram.percentile(90) / MS
+            << std::setw(10) << histogram.percentile(99) / MS
+            << std::setw(10) << histogram.max() / MS << std::endl;
+    }
+
+    out.flags(flags);
+    out.precision(precision);
+}
+
+/**
+ * Append the summary to a file
+ */
+bool Telemetry::saveSummary(const std::string& path) const {
+    std::ofstream file(path, std::ios::app);
+    if (!file.is_open()) {
+        return false;
+    }
+    writeSummary(file);
+    file << std::endl;
+    return true;
+}
+
+/**
+ * Get steady_clock time in nanoseconds
+ */
+int64_t Telemetry::now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * Get metric name
+ */
+const char* Telemetry::metricName(Metric metric) {
+    switch (metric) {
+        case Metric::MOVE_LATENCY: return "move_latency";
+        case Metric::FRAME_TIME:   return "frame_time";
+        case Metric::SOLVE_TIME:   return "solve_time";
+        case Metric::COUNT:        break;
+    }
+    return "unknown";
+}
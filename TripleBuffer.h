@@ -0,0 +1,72 @@
+#ifndef TRIPLE_BUFFER_H
+#define TRIPLE_BUFFER_H
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * TripleBuffer class template
+ * Lock-free "latest value" handoff from one producer thread to one
+ * consumer thread. The producer fills its own slot and publishes it by
+ * swapping it with the shared middle slot; the consumer swaps its slot
+ * with the middle one only when something new was published. Neither side
+ * ever waits for the other, values published in between two takes are
+ * simply replaced (the consumer always gets the newest), and slots are
+ * reused so steady state allocates nothing
+ * Member: 5 - Game management
+ */
+template <typename T>
+class TripleBuffer {
+private:
+    static const uint8_t INDEX_MASK = 0x3;
+    static const uint8_t FRESH = 0x4;      // Middle slot not taken yet
+
+    T slots[3];
+    alignas(64) std::atomic<uint8_t> middle;   // Index | FRESH
+    alignas(64) uint8_t writeIndex;            // Producer only
+    alignas(64) uint8_t readIndex;             // Consumer only
+
+public:
+    TripleBuffer() : middle(1), writeIndex(0), readIndex(2) {}
+
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    /**
+     * Producer: the slot to fill next (holds an older value, overwrite it)
+     */
+    T& writeSlot() {
+        return slots[writeIndex];
+    }
+
+    /**
+     * Producer: make the filled slot the newest value
+     * Returns true if the previous value was never taken (it is dropped)
+     */
+    bool publish() {
+        uint8_t previous = middle.exchange(writeIndex | FRESH, std::memory_order_acq_rel);
+        writeIndex = previous & INDEX_MASK;
+        return (previous & FRESH) != 0;
+    }
+
+    /**
+     * Consumer: move to the newest value, returns false if nothing new
+     */
+    bool take() {
+        if ((middle.load(std::memory_order_relaxed) & FRESH) == 0) {
+            return false;
+        }
+        uint8_t previous = middle.exchange(readIndex, std::memory_order_acq_rel);
+        readIndex = previous & INDEX_MASK;
+        return true;
+    }
+
+    /**
+     * Consumer: the value from the last successful take()
+     */
+    const T& readSlot() const {
+        return slots[readIndex];
+    }
+};
+
+#endif // TRIPLE_BUFFER_H
@@ -13,12 +13,13 @@
 
 /**
  * Clear the console screen (cross-platform)
+ * ANSI home + erase instead of running the clear command in a subshell
  */
 void Utilities::clearScreen() {
 #ifdef _WIN32
     system("cls");
 #else
-    system("clear");
+    std::cout << "\033[H\033[2J\033[3J" << std::flush;
 #endif
 }
 
@@ -88,6 +89,15 @@ long long Utilities::getCurrentTime() {
     return std::chrono::duration_cast<std::chrono::seconds>(duration).count();
 }
 
+/**
+ * Get steady_clock time in milliseconds (unaffected by clock changes)
+ */
+long long Utilities::getCurrentTimeMs() {
+    auto now = std::chrono::steady_clock::now();
+    auto duration = now.time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::milliseconds>(duration).count();
+}
+
 /**
  * Print a separator line
  */
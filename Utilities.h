@@ -27,6 +27,9 @@ public:
     // Get current time in seconds (for timing)
     static long long getCurrentTime();
     
+    // Get monotonic time in milliseconds (for measuring durations)
+    static long long getCurrentTimeMs();
+    
     // Print separator line
     static void printSeparator(int length = 50);
     
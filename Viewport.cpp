@@ -0,0 +1,157 @@
+#include "Viewport.h"
+#include <algorithm>
+#include <cstdlib>
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <unistd.h>
+    #include <sys/ioctl.h>
+    #include <signal.h>
+#endif
+
+volatile std::sig_atomic_t Viewport::resizePending = 0;
+
+/**
+ * Constructor: Install the resize handler, size is read on first use
+ */
+Viewport::Viewport(int reservedRows)
+    : left(0), top(0), columns(0), rows(0), terminalColumns(0), terminalRows(0),
+      reservedRows(reservedRows), sized(false) {
+#ifndef _WIN32
+    struct sigaction action;
+    action.sa_handler = &Viewport::onResize;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESTART;
+    sigaction(SIGWINCH, &action, nullptr);
+#endif
+}
+
+/**
+ * SIGWINCH handler: only sets a flag, the size is read on the next frame
+ */
+void Viewport::onResize(int signal) {
+    (void)signal;
+    resizePending = 1;
+}
+
+/**
+ * Re-read the terminal size if it may have changed
+ */
+bool Viewport::updateTerminalSize() {
+#ifdef _WIN32
+    // No resize signal on Windows; the console query is cheap enough per frame
+    bool check = true;
+#else
+    bool check = !sized || resizePending;
+#endif
+    if (!check) {
+        return false;
+    }
+    resizePending = 0;
+
+    int newColumns, newRows;
+    queryTerminalSize(newColumns, newRows);
+    bool changed = !sized || newColumns != terminalColumns || newRows != terminalRows;
+    terminalColumns = newColumns;
+    terminalRows = newRows;
+    sized = true;
+    return changed;
+}
+
+/**
+ * Scroll the window to keep (x, y) away from its edges
+ */
+void Viewport::follow(int x, int y, int mazeWidth, int mazeHeight) {
+    if (!sized) {
+        updateTerminalSize();
+    }
+
+    columns = std::max(1, std::min(mazeWidth, terminalColumns));
+    rows = std::max(1, std::min(mazeHeight, terminalRows - reservedRows));
+
+    // Scroll once the cell gets within a quarter window of an edge
+    int marginX = columns / 4;
+    int marginY = rows / 4;
+
+    if (x < left + marginX) {
+        left = x - marginX;
+    } else if (x > left + columns - 1 - marginX) {
+        left = x - (columns - 1 - marginX);
+    }
+    if (y < top + marginY) {
+        top = y - marginY;
+    } else if (y > top + rows - 1 - marginY) {
+        top = y - (rows - 1 - marginY);
+    }
+
+    left = std::max(0, std::min(left, mazeWidth - columns));
+    top = std::max(0, std::min(top, mazeHeight - rows));
+}
+
+/**
+ * Check if a maze cell is inside the window
+ */
+bool Viewport::contains(int x, int y) const {
+    return x >= left && x < left + columns && y >= top && y < top + rows;
+}
+
+/**
+ * Get leftmost visible column
+ */
+int Viewport::getLeft() const {
+    return left;
+}
+
+/**
+ * Get topmost visible row
+ */
+int Viewport::getTop() const {
+    return top;
+}
+
+/**
+ * Get window width in cells
+ */
+int Viewport::getColumns() const {
+    return columns;
+}
+
+/**
+ * Get window height in cells
+ */
+int Viewport::getRows() const {
+    return rows;
+}
+
+/**
+ * Get the terminal size
+ */
+void Viewport::queryTerminalSize(int& columns, int& rows) {
+    columns = 0;
+    rows = 0;
+
+#ifdef _WIN32
+    CONSOLE_SCREEN_BUFFER_INFO info;
+    if (GetConsoleScreenBufferInfo(GetStdHandle(STD_OUTPUT_HANDLE), &info)) {
+        columns = info.srWindow.Right - info.srWindow.Left + 1;
+        rows = info.srWindow.Bottom - info.srWindow.Top + 1;
+    }
+#else
+    struct winsize size;
+    if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &size) == 0) {
+        columns = size.ws_col;
+        rows = size.ws_row;
+    }
+#endif
+
+    // Not a terminal (or it didn't say): environment, then the classic size
+    if (columns <= 0 || rows <= 0) {
+        const char* envColumns = std::getenv("COLUMNS");
+        const char* envRows = std::getenv("LINES");
+        columns = envColumns ? std::atoi(envColumns) : 0;
+        rows = envRows ? std::atoi(envRows) : 0;
+    }
+    if (columns <= 0) columns = 80;
+    if (rows <= 0) rows = 24;
+}
@@ -0,0 +1,55 @@
+#ifndef VIEWPORT_H
+#define VIEWPORT_H
+
+#include <csignal>
+
+/**
+ * Viewport class
+ * Camera over the maze for mazes larger than the terminal
+ * The visible window is sized from the terminal (TIOCGWINSZ, re-read after
+ * SIGWINCH) minus the rows kept for status text, and scrolls to keep the
+ * followed cell away from the window edges. Only cells inside the window
+ * are composed and drawn, so frame cost depends on the terminal size and
+ * not on the maze size
+ * Member: 6 - Utility + Display
+ */
+class Viewport {
+private:
+    int left;           // Maze cell shown in the top-left corner
+    int top;
+    int columns;        // Window size in cells
+    int rows;
+    int terminalColumns;
+    int terminalRows;
+    int reservedRows;   // Terminal rows kept free below the maze
+    bool sized;         // Terminal size read at least once
+
+    // Set by the SIGWINCH handler, cleared when the size is re-read
+    static volatile std::sig_atomic_t resizePending;
+    static void onResize(int signal);
+
+public:
+    // Constructor: reservedRows lines stay free for status text
+    explicit Viewport(int reservedRows = 8);
+
+    // Re-read the terminal size if it may have changed
+    // Returns true if it did (the screen should be redrawn fully)
+    bool updateTerminalSize();
+
+    // Scroll so (x, y) stays inside the window with a margin, clamped to
+    // the maze; the window shrinks to the maze if the maze is smaller
+    void follow(int x, int y, int mazeWidth, int mazeHeight);
+
+    // Check if a maze cell is inside the window
+    bool contains(int x, int y) const;
+
+    int getLeft() const;
+    int getTop() const;
+    int getColumns() const;
+    int getRows() const;
+
+    // Current terminal size (falls back to $COLUMNS/$LINES, then 80x24)
+    static void queryTerminalSize(int& columns, int& rows);
+};
+
+#endif // VIEWPORT_H
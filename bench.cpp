@@ -0,0 +1,172 @@
+#include <iostream>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <filesystem>
+#include "Benchmark.h"
+#include "MazeGenerator.h"
+#include "AIPathfinder.h"
+#include "Player.h"
+#include "GameManager.h"
+
+/**
+ * Micro-benchmark suite (built by "make bench")
+ * Maze generation, BFS / Dijkstra pathfinding, player moves and the
+ * leaderboard top-10 query at sizes from 15 to 16383
+ */
+
+namespace {
+
+// Results are folded in here so the optimizer can't drop the work
+volatile size_t sink = 0;
+
+const int MOVES_PER_SAMPLE = 1000;
+const int TOP_SCORES_PER_SAMPLE = 100;
+const uint32_t BENCH_SEED = 20240601;
+
+/**
+ * A generated maze shared by the samples of one size
+ */
+std::shared_ptr<MazeGenerator> makeMaze(int size) {
+    auto maze = std::make_shared<MazeGenerator>(size, size);
+    maze->generateMaze(BENCH_SEED);
+    return maze;
+}
+
+/**
+ * Leaderboard with a given number of players, set up in a scratch
+ * directory (GameManager keeps its files in the working directory)
+ */
+class ScoreBoardFixture {
+private:
+    std::filesystem::path previousDirectory;
+    std::filesystem::path directory;
+    std::unique_ptr<GameManager> manager;
+
+public:
+    explicit ScoreBoardFixture(int players) {
+        previousDirectory = std::filesystem::current_path();
+        directory = std::filesystem::temp_directory_path() /
+                    ("mazerunner-bench-" + std::to_string(std::random_device{}()));
+        std::filesystem::create_directories(directory);
+        std::filesystem::current_path(directory);
+
+        // Import a legacy score file, which compacts it into the binary
+        // snapshot; the benchmark then runs on a freshly opened board
+        {
+            std::ofstream legacy("highscores.txt");
+            std::mt19937 rng(BENCH_SEED);
+            std::uniform_int_distribution<int> points(0, 20000);
+            for (int i = 0; i < players; i++) {
+                legacy << "player" << i << " " << points(rng) << "\n";
+            }
+        }
+        { GameManager importer; }
+        manager.reset(new GameManager());
+    }
+
+    ~ScoreBoardFixture() {
+        manager.reset();
+        std::filesystem::current_path(previousDirectory);
+        std::error_code ignored;
+        std::filesystem::remove_all(directory, ignored);
+    }
+
+    GameManager& get() {
+        return *manager;
+    }
+};
+
+} // namespace
+
+/**
+ * Main function
+ */
+int main(int argc, char* argv[]) {
+    Benchmark::Options options;
+    std::string error;
+    if (!Benchmark::parse(argc, argv, options, error)) {
+        std::cerr << "Error: " << error << std::endl;
+        Benchmark::printUsage(std::cerr, argv[0]);
+        return 1;
+    }
+
+    Benchmark bench(options);
+
+    bench.add("MazeGenerator::generateMaze", "cells per side", 1, 2.0, [](int size) {
+        auto maze = std::make_shared<MazeGenerator>(size, size);
+        auto seed = std::make_shared<uint32_t>(BENCH_SEED);
+        return Benchmark::Sample([maze, seed]() {
+            maze->generateMaze((*seed)++);
+            sink = sink + maze->getCell(1, 1);
+        });
+    });
+
+    bench.add("AIPathfinder::findPathBFS", "cells per side", 1, 2.0, [](int size) {
+        auto maze = makeMaze(size);
+        return Benchmark::Sample([maze]() {
+            AIPathfinder pathfinder;
+            auto start = maze->getStartPosition();
+            auto exit = maze->getExitPosition();
+            sink = sink + pathfinder.findPathBFS(start.first, start.second, exit.first, exit.second, *maze).size();
+        });
+    });
+
+    bench.add("AIPathfinder::findPathDijkstra", "cells per side", 1, 2.0, [](int size) {
+        auto maze = makeMaze(size);
+        return Benchmark::Sample([maze]() {
+            AIPathfinder pathfinder;
+            auto start = maze->getStartPosition();
+            auto exit = maze->getExitPosition();
+            sink = sink + pathfinder.findPathDijkstra(start.first, start.second, exit.first, exit.second, *maze).size();
+        });
+    });
+
+    // Random key presses from the start cell: a mix of moves and blocked
+    // attempts, as in play; the player is reset between samples
+    bench.add("Player::move", "cells per side", MOVES_PER_SAMPLE, 0.0, [](int size) {
+        auto maze = makeMaze(size);
+        auto keys = std::make_shared<std::string>();
+        std::mt19937 rng(BENCH_SEED);
+        const char directions[] = { 'w', 'a', 's', 'd' };
+        for (int i = 0; i < MOVES_PER_SAMPLE; i++) {
+            keys->push_back(directions[rng() % 4]);
+        }
+        auto player = std::make_shared<Player>();
+        return Benchmark::Sample([maze, keys, player]() {
+            auto start = maze->getStartPosition();
+            player->initialize(start.first, start.second);
+            for (char key : *keys) {
+                player->move(key, *maze);
+            }
+            sink = sink + player->getMoves();
+        });
+    });
+
+    bench.add("GameManager::getTopScores", "players on the board", TOP_SCORES_PER_SAMPLE, 0.0, [](int size) {
+        auto fixture = std::make_shared<ScoreBoardFixture>(size);
+        return Benchmark::Sample([fixture]() {
+            for (int i = 0; i < TOP_SCORES_PER_SAMPLE; i++) {
+                sink = sink + fixture->get().getTopScores(10).size();
+            }
+        });
+    });
+
+    // With JSON on stdout the table goes to stderr
+    bool jsonToStdout = (options.outputPath == "-");
+    bench.run(jsonToStdout ? std::cerr : std::cout);
+
+    if (jsonToStdout) {
+        bench.writeJson(std::cout);
+    } else if (!options.outputPath.empty()) {
+        std::ofstream json(options.outputPath);
+        if (!json.is_open()) {
+            std::cerr << "Could not write " << options.outputPath << std::endl;
+            return 1;
+        }
+        bench.writeJson(json);
+        std::cout << "Results written to " << options.outputPath << std::endl;
+    }
+
+    return 0;
+}
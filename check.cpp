@@ -0,0 +1,75 @@
+#include <iostream>
+#include <vector>
+#include "MazeGenerator.h"
+#include "AgentBatch.h"
+
+/**
+ * Self-checks (built and run by "make check")
+ * Exercises the threaded code paths with sizes chosen around their block
+ * boundaries; kept out of the game binary
+ */
+
+namespace {
+
+/**
+ * AgentBatch threading
+ * On an open maze every random step moves every agent, so after each step
+ * all agents must have left their previous cell, whatever the agent count
+ * and thread split; positions must also match the single-threaded run
+ */
+bool checkAgentBatch() {
+    MazeGenerator maze(15, 15);
+    maze.generateMaze(1);
+    for (int y = 1; y < maze.getHeight() - 1; y++) {
+        for (int x = 1; x < maze.getWidth() - 1; x++) {
+            maze.setWall(x, y, false);
+        }
+    }
+    const int center = 7;
+    const int steps = 3;
+    
+    // Counts around the 4096-agent block size and its multiples of 64
+    const size_t counts[] = { 1, 63, 8192, 8193, 12288, 12289, 12353, 20481, 100003 };
+    const int threadCounts[] = { 1, 2, 3, 4, 8 };
+    int failures = 0;
+    
+    for (size_t count : counts) {
+        std::vector<int> expected;
+        for (int threads : threadCounts) {
+            AgentBatch crowd(maze, count, center, center);
+            std::vector<int> previous(count, maze.getPassabilityIndex(center, center));
+            size_t stuck = 0;
+            for (int s = 0; s < steps; s++) {
+                crowd.stepRandom((uint32_t)s * 0x85EBCA6Bu + 1, threads);
+                for (size_t i = 0; i < count; i++) {
+                    int index = maze.getPassabilityIndex(crowd.getX(i), crowd.getY(i));
+                    stuck += (index == previous[i]);
+                    previous[i] = index;
+                }
+            }
+            bool sameAsSerial = expected.empty() || previous == expected;
+            if (expected.empty()) {
+                expected = previous;
+            }
+            
+            bool ok = (stuck == 0 && sameAsSerial);
+            failures += !ok;
+            std::cout << "agents=" << count << " threads=" << threads
+                      << " unmoved=" << stuck << " matches_serial=" << (sameAsSerial ? "yes" : "no")
+                      << (ok ? " ok" : " FAILED") << std::endl;
+        }
+    }
+    
+    return failures == 0;
+}
+
+} // namespace
+
+/**
+ * Run every check, exit status 1 if any failed
+ */
+int main() {
+    bool ok = checkAgentBatch();
+    std::cout << (ok ? "All checks passed" : "Some checks FAILED") << std::endl;
+    return ok ? 0 : 1;
+}
@@ -4,7 +4,7 @@
 echo "Compiling ASCII Maze Runner Game..."
 echo ""
 
-g++ -std=c++17 main.cpp MazeGenerator.cpp Player.cpp AIPathfinder.cpp GameManager.cpp Utilities.cpp -o MazeRunner
+g++ -std=c++17 -O2 -pthread main.cpp MazeGenerator.cpp Player.cpp AIPathfinder.cpp GameManager.cpp Utilities.cpp PathSearch.cpp DStarLite.cpp FlowField.cpp RoutePlanner.cpp MappedFile.cpp ExternalSolver.cpp MoveHistory.cpp AgentBatch.cpp EventLog.cpp ReplayVerifier.cpp Leaderboard.cpp ScoreJournal.cpp LeaderboardFile.cpp ConcurrentLeaderboard.cpp Telemetry.cpp FrameRenderer.cpp RenderThread.cpp Viewport.cpp RawTerminal.cpp AnimationScheduler.cpp ImageExporter.cpp CommandLine.cpp -o MazeRunner
 
 if [ $? -eq 0 ]; then
     echo ""
@@ -3,66 +3,54 @@
 #include <cstdlib>
 #include <limits>
 #include <iomanip>
+#include <chrono>
+#include <algorithm>
+#include <random>
+#include <thread>
 #include "MazeGenerator.h"
 #include "Player.h"
 #include "AIPathfinder.h"
+#include "DStarLite.h"
+#include "FlowField.h"
+#include "RoutePlanner.h"
+#include "AgentBatch.h"
+#include "ReplayVerifier.h"
 #include "GameManager.h"
+#include "Telemetry.h"
+#include "FrameRenderer.h"
+#include "RenderThread.h"
+#include "Viewport.h"
+#include "RawTerminal.h"
+#include "AnimationScheduler.h"
+#include "CommandLine.h"
 #include "Utilities.h"
 
-#ifdef _WIN32
-#include <conio.h>
-#include <windows.h>
-#else
-#include <termios.h>
-#include <unistd.h>
-#include <fcntl.h>
-#endif
-
 // Forward declarations
 void displayMenu();
 void playGame();
 void watchAISolve();
 void viewHighScores();
-void displayMaze(const MazeGenerator& maze, const Player& player, 
+void shiftRandomWall(MazeGenerator& maze, const Player& player,
+                     DStarLite& planner, std::mt19937& rng);
+std::vector<std::pair<int, int>> spawnEnemies(const MazeGenerator& maze,
+                                              const FlowField& field, int count);
+bool moveEnemies(std::vector<std::pair<int, int>>& enemies, FlowField& field,
+                 const Player& player);
+std::vector<std::pair<int, int>> scatterItems(const MazeGenerator& maze, int count);
+void runCrowdSimulation();
+void composeWindow(FrameRenderer& renderer, Viewport& view,
+                   const MazeGenerator& maze, int focusX, int focusY);
+void displayTrail(FrameRenderer& renderer, Viewport& view,
+                  const MazeGenerator& maze, const Player& player,
+                  int focusX, int focusY, const std::vector<char>& trail);
+void displayMaze(FrameRenderer& renderer, Viewport& view,
+                 const MazeGenerator& maze, const Player& player, 
                  const std::vector<std::pair<int, int>>& aiPath = {}, 
-                 int currentAIStep = -1);
-char getInput();
+                 int currentAIStep = -1,
+                 const std::vector<std::pair<int, int>>& enemies = {},
+                 const std::vector<std::pair<int, int>>& items = {});
 void displayInstructions();
 
-/**
- * Get character input (non-blocking)
- */
-char getInput() {
-#ifdef _WIN32
-    if (_kbhit()) {
-        return _getch();
-    }
-    return 0;
-#else
-    char ch = 0;
-    struct termios oldt, newt;
-    int oldf;
-    
-    // Save terminal settings
-    tcgetattr(STDIN_FILENO, &oldt);
-    newt = oldt;
-    newt.c_lflag &= ~(ICANON | ECHO);
-    tcsetattr(STDIN_FILENO, TCSANOW, &newt);
-    oldf = fcntl(STDIN_FILENO, F_GETFL, 0);
-    fcntl(STDIN_FILENO, F_SETFL, oldf | O_NONBLOCK);
-    
-    // Try to read a character
-    int result = read(STDIN_FILENO, &ch, 1);
-    
-    // Restore terminal settings
-    tcsetattr(STDIN_FILENO, TCSANOW, &oldt);
-    fcntl(STDIN_FILENO, F_SETFL, oldf);
-    
-    // Return character if read, otherwise 0
-    return (result > 0) ? ch : 0;
-#endif
-}
-
 /**
  * Display the main menu
  */
@@ -78,12 +66,13 @@ void displayMenu() {
     std::cout << "  2. Example Run" << std::endl;
     std::cout << "  3. View High Scores" << std::endl;
     std::cout << "  4. Instructions" << std::endl;
-    std::cout << "  5. Exit" << std::endl;
+    std::cout << "  5. Crowd Simulation" << std::endl;
+    std::cout << "  6. Exit" << std::endl;
     Utilities::resetColor();
     
     std::cout << std::endl;
     Utilities::printSeparator(60);
-    std::cout << "Enter your choice (1-5): ";
+    std::cout << "Enter your choice (1-6): ";
 }
 
 /**
@@ -101,6 +90,12 @@ void displayInstructions() {
     std::cout << "    S - Move Down" << std::endl;
     std::cout << "    A - Move Left" << std::endl;
     std::cout << "    D - Move Right" << std::endl;
+    std::cout << "    (arrow keys work too, no Enter needed)" << std::endl;
+    std::cout << "    U - Undo Move (counts as a move)" << std::endl;
+    std::cout << "    R - Redo Move (counts as a move)" << std::endl;
+    std::cout << "    T - Rewind to Step N (one move per step)" << std::endl;
+    std::cout << "    (U/R/T are off in Chase and Collect modes)" << std::endl;
+    std::cout << "    H - Toggle Hint (route to exit)" << std::endl;
     std::cout << "    Q - Quit Game" << std::endl;
     std::cout << std::endl;
     
@@ -110,12 +105,18 @@ void displayInstructions() {
     std::cout << "    P - Player" << std::endl;
     std::cout << "    S - Start" << std::endl;
     std::cout << "    E - Exit" << std::endl;
+    std::cout << "    X - Enemy (Chase mode)" << std::endl;
+    std::cout << "    $ - Collectible (Collect mode)" << std::endl;
     std::cout << "    * - Example path (when watching example run)" << std::endl;
+    std::cout << "    . - Cells explored by the search (example run)" << std::endl;
     std::cout << std::endl;
     
     std::cout << "  Objective:" << std::endl;
     std::cout << "    Navigate from S (Start) to E (Exit)" << std::endl;
     std::cout << "    Try to complete in as few moves as possible!" << std::endl;
+    std::cout << "    In Dynamic Walls mode, walls open and close as you move" << std::endl;
+    std::cout << "    In Chase mode, reach the exit before an enemy catches you" << std::endl;
+    std::cout << "    In Collect mode, gather every $ before heading to the exit" << std::endl;
     std::cout << std::endl;
     
     Utilities::printSeparator(60);
@@ -125,66 +126,214 @@ void displayInstructions() {
 }
 
 /**
- * Display maze with player and optional example path
+ * Compose the maze cells of the window around (focusX, focusY) into the
+ * renderer, resizing the window to the terminal first
  */
-void displayMaze(const MazeGenerator& maze, const Player& player, 
-                 const std::vector<std::pair<int, int>>& aiPath, 
-                 int currentAIStep) {
-    auto mazeGrid = maze.getMaze();
+void composeWindow(FrameRenderer& renderer, Viewport& view,
+                   const MazeGenerator& maze, int focusX, int focusY) {
+    // Terminal resized: what is on screen can't be trusted any more
+    if (view.updateTerminalSize()) {
+        renderer.invalidate();
+    }
+    view.follow(focusX, focusY, maze.getWidth(), maze.getHeight());
+    
+    int left = view.getLeft();
+    int top = view.getTop();
+    
+    // Base layer straight from the maze grid, visible window only
+    renderer.resize(view.getColumns(), view.getRows());
+    for (int y = 0; y < view.getRows(); y++) {
+        for (int x = 0; x < view.getColumns(); x++) {
+            renderer.setCell(x, y, maze.getCell(left + x, top + y));
+        }
+    }
+}
+
+/**
+ * Compose the window around (focusX, focusY) with a per-cell trail layer
+ * (row-major, 0 = nothing) and the player on top
+ * Cost depends on the window size only, however long the trail is
+ */
+void displayTrail(FrameRenderer& renderer, Viewport& view,
+                  const MazeGenerator& maze, const Player& player,
+                  int focusX, int focusY, const std::vector<char>& trail) {
+    composeWindow(renderer, view, maze, focusX, focusY);
+    
+    int left = view.getLeft();
+    int top = view.getTop();
     int width = maze.getWidth();
-    int height = maze.getHeight();
     
-    // Create a copy for display
-    std::vector<std::vector<char>> display = mazeGrid;
+    for (int y = 0; y < view.getRows(); y++) {
+        const char* row = trail.data() + (size_t)(top + y) * width + left;
+        for (int x = 0; x < view.getColumns(); x++) {
+            char c = renderer.getCell(x, y);
+            if (row[x] != 0 && c != 'S' && c != 'E') {
+                renderer.setCell(x, y, row[x]);
+            }
+        }
+    }
+    
+    if (view.contains(player.getX(), player.getY()) &&
+        renderer.getCell(player.getX() - left, player.getY() - top) != 'E') {
+        renderer.setCell(player.getX() - left, player.getY() - top, 'P');
+    }
+}
+
+/**
+ * Compose the part of the maze around the player that fits the terminal,
+ * with optional route, enemies and collectibles, into the renderer
+ * (drawn by the next present())
+ */
+void displayMaze(FrameRenderer& renderer, Viewport& view,
+                 const MazeGenerator& maze, const Player& player, 
+                 const std::vector<std::pair<int, int>>& aiPath, 
+                 int currentAIStep,
+                 const std::vector<std::pair<int, int>>& enemies,
+                 const std::vector<std::pair<int, int>>& items) {
+    composeWindow(renderer, view, maze, player.getX(), player.getY());
+    
+    int left = view.getLeft();
+    int top = view.getTop();
+    
+    // Overlay one marker if the cell is in view (start and exit stay visible)
+    auto mark = [&](int x, int y, char glyph, bool keepEnds) {
+        if (!view.contains(x, y)) {
+            return;
+        }
+        char c = renderer.getCell(x - left, y - top);
+        if (!keepEnds || (c != 'S' && c != 'E')) {
+            renderer.setCell(x - left, y - top, glyph);
+        }
+    };
     
     // Draw example path if provided
     if (!aiPath.empty() && currentAIStep >= 0) {
         for (int i = 0; i <= currentAIStep && i < (int)aiPath.size(); i++) {
-            int x = aiPath[i].first;
-            int y = aiPath[i].second;
-            if (display[y][x] != 'S' && display[y][x] != 'E') {
-                display[y][x] = '*';
-            }
+            mark(aiPath[i].first, aiPath[i].second, '*', true);
         }
     }
     
+    // Draw collectibles
+    for (const auto& item : items) {
+        mark(item.first, item.second, '$', false);
+    }
+    
+    // Draw enemies
+    for (const auto& enemy : enemies) {
+        mark(enemy.first, enemy.second, 'X', false);
+    }
+    
     // Draw player
-    int px = player.getX();
-    int py = player.getY();
-    if (px >= 0 && px < width && py >= 0 && py < height) {
-        if (display[py][px] != 'E') {
-            display[py][px] = 'P';
+    if (view.contains(player.getX(), player.getY()) &&
+        renderer.getCell(player.getX() - left, player.getY() - top) != 'E') {
+        renderer.setCell(player.getX() - left, player.getY() - top, 'P');
+    }
+}
+
+/**
+ * Dynamic walls: open or close one random connecting wall
+ * Only cells between two rooms (exactly one odd coordinate) are toggled,
+ * so the maze keeps its grid look while loops and dead ends come and go
+ */
+void shiftRandomWall(MazeGenerator& maze, const Player& player,
+                     DStarLite& planner, std::mt19937& rng) {
+    std::uniform_int_distribution<> disX(1, maze.getWidth() - 2);
+    std::uniform_int_distribution<> disY(1, maze.getHeight() - 2);
+    
+    for (int attempt = 0; attempt < 16; attempt++) {
+        int x = disX(rng);
+        int y = disY(rng);
+        
+        if ((x + y) % 2 == 0) continue;
+        if (x == player.getX() && y == player.getY()) continue;
+        
+        bool isWall = !maze.isValidPath(x, y);
+        if (maze.setWall(x, y, !isWall)) {
+            planner.notifyCellChanged(x, y);
+            return;
+        }
+    }
+}
+
+/**
+ * Collect mode: place items on distinct open cells (never start or exit)
+ */
+std::vector<std::pair<int, int>> scatterItems(const MazeGenerator& maze, int count) {
+    std::vector<std::pair<int, int>> candidates;
+    
+    for (int y = 0; y < maze.getHeight(); y++) {
+        for (int x = 0; x < maze.getWidth(); x++) {
+            if (maze.isValidPath(x, y) &&
+                std::make_pair(x, y) != maze.getStartPosition() &&
+                std::make_pair(x, y) != maze.getExitPosition()) {
+                candidates.push_back(std::make_pair(x, y));
+            }
         }
     }
     
-    // Print maze
-    for (int i = 0; i < height; i++) {
-        for (int j = 0; j < width; j++) {
-            char cell = display[i][j];
-            
-            // Color coding
-            if (cell == 'P') {
-                Utilities::setColor("green");
-                std::cout << cell;
-                Utilities::resetColor();
-            } else if (cell == 'E') {
-                Utilities::setColor("red");
-                std::cout << cell;
-                Utilities::resetColor();
-            } else if (cell == 'S') {
-                Utilities::setColor("blue");
-                std::cout << cell;
-                Utilities::resetColor();
-            } else if (cell == '*') {
-                Utilities::setColor("yellow");
-                std::cout << cell;
-                Utilities::resetColor();
-            } else {
-                std::cout << cell;
+    std::mt19937 rng(std::random_device{}());
+    std::shuffle(candidates.begin(), candidates.end(), rng);
+    if ((int)candidates.size() > count) {
+        candidates.resize(count);
+    }
+    
+    return candidates;
+}
+
+/**
+ * Chase mode: place enemies on random open cells away from the player
+ * Uses the flow field distances so nobody spawns right next to the start
+ */
+std::vector<std::pair<int, int>> spawnEnemies(const MazeGenerator& maze,
+                                              const FlowField& field, int count) {
+    std::vector<std::pair<int, int>> candidates;
+    int minDistance = (maze.getWidth() + maze.getHeight()) / 2;
+    
+    for (int y = 0; y < maze.getHeight(); y++) {
+        for (int x = 0; x < maze.getWidth(); x++) {
+            if (field.distanceAt(x, y) >= minDistance) {
+                candidates.push_back(std::make_pair(x, y));
             }
         }
-        std::cout << std::endl;
     }
+    
+    std::vector<std::pair<int, int>> enemies;
+    if (candidates.empty()) {
+        return enemies;
+    }
+    
+    std::mt19937 rng(std::random_device{}());
+    std::uniform_int_distribution<> dis(0, candidates.size() - 1);
+    for (int i = 0; i < count; i++) {
+        enemies.push_back(candidates[dis(rng)]);
+    }
+    
+    return enemies;
+}
+
+/**
+ * Chase mode: refresh the shared flow field once, then step every enemy
+ * with a single lookup each. Returns true if any enemy caught the player
+ */
+bool moveEnemies(std::vector<std::pair<int, int>>& enemies, FlowField& field,
+                 const Player& player) {
+    std::pair<int, int> playerPos(player.getX(), player.getY());
+    field.moveTarget(playerPos.first, playerPos.second);
+    
+    bool caught = false;
+    for (auto& enemy : enemies) {
+        // Player walked into this enemy
+        if (enemy == playerPos) {
+            caught = true;
+            continue;
+        }
+        enemy = field.nextStep(enemy.first, enemy.second);
+        if (enemy == playerPos) {
+            caught = true;
+        }
+    }
+    
+    return caught;
 }
 
 /**
@@ -193,12 +342,37 @@ void displayMaze(const MazeGenerator& maze, const Player& player,
 void playGame() {
     Utilities::clearScreen();
     
-    // Ask for maze size
+    // Ask for maze size (larger than the terminal scrolls with the player;
+    // capped where replays can still be verified)
     int size = 21;
-    std::cout << "Enter maze size (15, 21, or 25): ";
+    std::cout << "Enter maze size (15-" << ReplayVerifier::MAX_SIZE << "): ";
     std::cin >> size;
     if (size < 15) size = 15;
-    if (size > 25) size = 25;
+    if (size > ReplayVerifier::MAX_SIZE) size = ReplayVerifier::MAX_SIZE;
+    
+    // Ask for game mode
+    int mode = 1;
+    std::cout << "Choose mode (1=Classic, 2=Dynamic Walls, 3=Chase, 4=Collect): ";
+    std::cin >> mode;
+    bool dynamicWalls = (mode == 2);
+    bool chaseMode = (mode == 3);
+    bool collectMode = (mode == 4);
+    
+    int enemyCount = 0;
+    if (chaseMode) {
+        std::cout << "Number of enemies (1-500): ";
+        std::cin >> enemyCount;
+        if (enemyCount < 1) enemyCount = 1;
+        if (enemyCount > 500) enemyCount = 500;
+    }
+    
+    int itemCount = 0;
+    if (collectMode) {
+        std::cout << "Number of collectibles (1-" << RoutePlanner::MAX_ITEMS << "): ";
+        std::cin >> itemCount;
+        if (itemCount < 1) itemCount = 1;
+        if (itemCount > RoutePlanner::MAX_ITEMS) itemCount = RoutePlanner::MAX_ITEMS;
+    }
     
     // Generate maze
     MazeGenerator maze(size, size);
@@ -216,67 +390,278 @@ void playGame() {
     // Initialize game manager
     GameManager gameManager;
     gameManager.startGame(1);
+    Telemetry& telemetry = gameManager.getTelemetry();
     
     // Find shortest path for efficiency calculation
     AIPathfinder pathfinder;
+    int64_t solveStart = Telemetry::now();
     auto shortestPath = pathfinder.findPathBFS(startX, startY, exitX, exitY, maze);
     int shortestPathLength = pathfinder.getPathLength(shortestPath);
+    telemetry.recordSince(Telemetry::Metric::SOLVE_TIME, solveStart);
+    
+    // Collect mode: scatter items, efficiency is measured against the
+    // optimal pickup route (start -> all items -> exit) instead
+    std::vector<std::pair<int, int>> items;
+    if (collectMode) {
+        items = scatterItems(maze, itemCount);
+        solveStart = Telemetry::now();
+        RoutePlanner routePlanner(maze);
+        shortestPathLength = routePlanner.planRoute(std::make_pair(startX, startY), items,
+                                                    std::make_pair(exitX, exitY));
+        telemetry.recordSince(Telemetry::Metric::SOLVE_TIME, solveStart);
+    }
+    
+    // Incremental planner for hints, repaired as the player moves and walls change
+    DStarLite hintPlanner(maze, startX, startY, exitX, exitY);
+    hintPlanner.computeShortestPath();
+    bool showHint = false;
+    
+    // Chase mode: every enemy follows one shared flow field toward the player
+    FlowField chaseField(maze);
+    std::vector<std::pair<int, int>> enemies;
+    if (chaseMode) {
+        chaseField.compute(startX, startY);
+        enemies = spawnEnemies(maze, chaseField, enemyCount);
+    }
+    bool caught = false;
+    
+    // Dynamic walls: toggle a random connecting wall every few moves
+    const int WALL_EDIT_INTERVAL = 2;
+    std::mt19937 wallRng(std::random_device{}());
     
     // Game loop
     bool gameRunning = true;
     bool gameWon = false;
+    int64_t inputTime = -1;     // When the last key was read, until its frame is published
+    FrameRenderer renderer;     // Frames are composed here, drawn by the render thread
+    Viewport view;              // Window of the maze that fits the terminal
     
-    std::cout << "Game starting! Use W/A/S/D to move, Q to quit." << std::endl;
+    std::cout << "Game starting! Use W/A/S/D or the arrow keys to move, H for hint, Q to quit." << std::endl;
     std::cout << "Press Enter to begin...";
     std::cin.ignore();
     std::cin.get();
     
-    while (gameRunning && !gameWon) {
-        Utilities::clearScreen();
+    // Keys are read raw (no Enter) until the run ends; the loop sleeps in
+    // poll() until a key arrives or the HUD clock's next second is due, so
+    // an idle game draws one frame (one write) per second
+    RawTerminal terminal;
+    RenderThread display(telemetry);        // Terminal writes happen off this thread
+    const int TICK_MS = 1000;               // HUD clock resolution
+    long long nextTick = Utilities::getCurrentTimeMs() + TICK_MS;
+    long long shownTick = -1;               // Clock value on screen, in ticks
+    bool redraw = true;
+    bool enteringStep = false;              // Typing a rewind step after T
+    // Undo / rewind only move the player, so they are off in the modes
+    // where enemies and collectibles would not follow
+    bool canRewind = !chaseMode && !collectMode;
+    std::string stepDigits;
+    std::vector<int> keys;
+    
+    while (gameRunning && !gameWon && !caught) {
+        if (redraw) {
+            // Display maze (with remaining route when hint is on)
+            int64_t replanStart = Telemetry::now();
+            hintPlanner.computeShortestPath();
+            telemetry.recordSince(Telemetry::Metric::SOLVE_TIME, replanStart);
+            if (showHint) {
+                auto hintPath = hintPlanner.getPath();
+                displayMaze(renderer, view, maze, player, hintPath, (int)hintPath.size() - 1, enemies, items);
+            } else {
+                displayMaze(renderer, view, maze, player, {}, -1, enemies, items);
+            }
+            
+            // Display stats (drawn with the maze in the same write); the
+            // next tick is when the clock shows the next second
+            long long elapsedMs = gameManager.getElapsedTimeMs();
+            shownTick = elapsedMs / TICK_MS;
+            nextTick = Utilities::getCurrentTimeMs() + TICK_MS - elapsedMs % TICK_MS;
+            
+            std::ostringstream& status = renderer.status();
+            status << std::endl << FrameRenderer::colorCode(FrameRenderer::Color::CYAN);
+            status << "Moves: " << player.getActionCount() 
+                   << " | Time: " << shownTick << "s"
+                   << (collectMode ? " | Optimal Route: " : " | Shortest Path: ")
+                   << shortestPathLength << " moves" << std::endl;
+            if (collectMode) {
+                status << "Collectibles left: " << items.size()
+                       << (items.empty() ? " - head for the exit!" : "") << std::endl;
+            }
+            if (dynamicWalls) {
+                int remaining = hintPlanner.getPathLength();
+                status << "Walls are shifting! Route to exit: ";
+                if (remaining < 0) {
+                    status << "blocked";
+                } else {
+                    status << remaining << " moves";
+                }
+                status << std::endl;
+            }
+            status << FrameRenderer::colorCode(FrameRenderer::Color::DEFAULT);
+            
+            if (enteringStep) {
+                status << "Rewind to step (0-" << player.getHistoryLength() << "), Enter to jump, Esc to cancel: "
+                       << stepDigits << std::endl;
+            } else {
+                status << "Controls: W/A/S/D or arrows to move, "
+                       << (canRewind ? "U/R to undo/redo, T to rewind, " : "")
+                       << "H to toggle hint, Q to quit" << std::endl;
+            }
+            
+            // Hand the frame over and carry on; the render thread times it
+            // and the keys that caused it once it is on screen
+            RenderThread::Snapshot& snapshot = display.nextSnapshot();
+            renderer.exportFrame(snapshot.frame);
+            snapshot.inputTime = inputTime;
+            display.publish();
+            inputTime = -1;
+            redraw = false;
+        }
         
-        // Display maze
-        displayMaze(maze, player);
+        // Sleep until a key arrives or the clock tick is due
+        long long waitMs = std::max(0LL, nextTick - Utilities::getCurrentTimeMs());
+        keys.clear();
+        int keyCount = terminal.readKeys((int)waitMs, keys);
+        if (keyCount < 0) {
+            gameRunning = false;                // Input closed
+            break;
+        }
+        if (keyCount == 0) {
+            // Tick: redraw only if the clock shows a new second; waking
+            // before the tick means a signal (terminal resize), which redraws
+            long long now = Utilities::getCurrentTimeMs();
+            long long elapsedMs = gameManager.getElapsedTimeMs();
+            if (now < nextTick || elapsedMs / TICK_MS != shownTick) {
+                redraw = true;
+            } else {
+                nextTick = now + TICK_MS - elapsedMs % TICK_MS;
+            }
+            continue;
+        }
+        inputTime = Telemetry::now();
+        redraw = true;
+        
+        // Everything queued (held keys repeat) is applied before one frame is drawn
+        for (int key : keys) {
+            if (!gameRunning || gameWon || caught) {
+                break;
+            }
+            
+            if (enteringStep) {
+                if (key >= '0' && key <= '9' && stepDigits.size() < 9) {
+                    stepDigits += (char)key;
+                } else if (key == RawTerminal::KEY_BACKSPACE && !stepDigits.empty()) {
+                    stepDigits.pop_back();
+                } else if (key == RawTerminal::KEY_ESCAPE) {
+                    enteringStep = false;
+                } else if (key == RawTerminal::KEY_ENTER) {
+                    enteringStep = false;
+                    if (!stepDigits.empty()) {
+                        int step = std::stoi(stepDigits);
+                        if (player.rewindTo(step, maze)) {
+                            hintPlanner.updateStart(player.getX(), player.getY());
+                            gameManager.addEvent(EventType::REWIND, player.getX(), player.getY(), step);
+                        }
+                    }
+                }
+                continue;
+            }
+            
+            // Arrow keys move like W/A/S/D
+            char input;
+            switch (key) {
+                case RawTerminal::KEY_UP:    input = 'w'; break;
+                case RawTerminal::KEY_DOWN:  input = 's'; break;
+                case RawTerminal::KEY_LEFT:  input = 'a'; break;
+                case RawTerminal::KEY_RIGHT: input = 'd'; break;
+                default: input = (key < 0x100) ? (char)key : 0; break;
+            }
+            
+            if (input == 'q' || input == 'Q' || key == RawTerminal::KEY_INTERRUPT) {
+                gameRunning = false;
+            } else if (input == 'h' || input == 'H') {
+                showHint = !showHint;
+            } else if (canRewind && (input == 'u' || input == 'U' || input == 'r' || input == 'R')) {
+                // Refused when shifting walls closed the cell we'd step back onto
+                bool undoing = (input == 'u' || input == 'U');
+                if (undoing ? player.undo(maze) : player.redo(maze)) {
+                    hintPlanner.updateStart(player.getX(), player.getY());
+                    gameManager.addEvent(undoing ? EventType::UNDO : EventType::REDO,
+                                         player.getX(), player.getY(), player.getMoves());
+                }
+            } else if (canRewind && (input == 't' || input == 'T')) {
+                enteringStep = true;
+                stepDigits.clear();
+            } else if (input == 'w' || input == 'W' || 
+                       input == 'a' || input == 'A' || 
+                       input == 's' || input == 'S' || 
+                       input == 'd' || input == 'D') {
+                if (player.move(input, maze)) {
+                    hintPlanner.updateStart(player.getX(), player.getY());
+                    gameManager.addEvent(EventType::MOVE, player.getX(), player.getY(), player.getMoves());
+                    
+                    if (dynamicWalls && player.getMoves() % WALL_EDIT_INTERVAL == 0) {
+                        shiftRandomWall(maze, player, hintPlanner, wallRng);
+                    }
+                    
+                    if (chaseMode) {
+                        caught = moveEnemies(enemies, chaseField, player);
+                        if (caught) {
+                            gameManager.addEvent(EventType::CAUGHT, player.getX(), player.getY(), player.getMoves());
+                        }
+                    }
+                    
+                    // Pick up a collectible on the new cell
+                    auto item = std::find(items.begin(), items.end(),
+                                          std::make_pair(player.getX(), player.getY()));
+                    if (item != items.end()) {
+                        items.erase(item);
+                        gameManager.addEvent(EventType::PICKUP, player.getX(), player.getY(), (int)items.size());
+                    }
+                }
+                
+                // Check if player reached exit (with every collectible gathered)
+                if (player.hasReachedExit(maze) && items.empty()) {
+                    gameWon = true;
+                }
+            }
+        }
+    }
+    
+    // Final frame goes out before the end screens print below it
+    if (caught) {
+        displayMaze(renderer, view, maze, player, {}, -1, enemies);
+    } else if (gameWon) {
+        displayMaze(renderer, view, maze, player);
+    }
+    if (caught || gameWon) {
+        RenderThread::Snapshot& snapshot = display.nextSnapshot();
+        renderer.exportFrame(snapshot.frame);
+        snapshot.inputTime = inputTime;
+        display.publish();
+    }
+    display.stop();
+    
+    // Back to line input for the end screens
+    terminal.restore();
+    
+    if (caught) {
         
-        // Display stats
         std::cout << std::endl;
-        Utilities::setColor("cyan");
-        std::cout << "Moves: " << player.getMoves() 
-                  << " | Time: " << gameManager.getElapsedTime() << "s"
-                  << " | Shortest Path: " << shortestPathLength << " moves" << std::endl;
+        Utilities::setColor("red");
+        std::cout << "You were caught after " << player.getActionCount() << " moves!" << std::endl;
         Utilities::resetColor();
         
-        std::cout << "Controls: W/A/S/D to move, Q to quit" << std::endl;
-        std::cout << "Enter move: ";
-        
-        // Get input (simpler blocking input)
-        std::string inputStr;
-        std::cin >> inputStr;
-        
-        if (inputStr.empty()) continue;
-        
-        char input = inputStr[0];
+        std::cout << std::endl;
+        telemetry.writeSummary(std::cout);
         
-        if (input == 'q' || input == 'Q') {
-            gameRunning = false;
-        } else if (input == 'w' || input == 'W' || 
-                   input == 'a' || input == 'A' || 
-                   input == 's' || input == 'S' || 
-                   input == 'd' || input == 'D') {
-            player.move(input, maze);
-            
-            // Check if player reached exit
-            if (player.hasReachedExit(maze)) {
-                gameWon = true;
-            }
-        }
+        std::cout << std::endl << "Press Enter to continue...";
+        std::cin.get();
     }
     
     if (gameWon) {
-        Utilities::clearScreen();
-        displayMaze(maze, player);
-        
-        int finalScore = gameManager.endGame(player.getMoves(), 
-                                            gameManager.getElapsedTime(), 
+        long long timeTakenMs = gameManager.getElapsedTimeMs();
+        int finalScore = gameManager.endGame(player.getActionCount(), 
+                                            timeTakenMs, 
                                             shortestPathLength);
         
         std::cout << std::endl;
@@ -284,25 +669,57 @@ void playGame() {
         std::cout << "Congratulations! You reached the exit!" << std::endl;
         Utilities::resetColor();
         
-        std::cout << "Moves: " << player.getMoves() << std::endl;
-        std::cout << "Time: " << gameManager.getElapsedTime() << " seconds" << std::endl;
-        std::cout << "Shortest Path: " << shortestPathLength << " moves" << std::endl;
-        std::cout << "Efficiency: " << gameManager.calculateEfficiency(player.getMoves(), shortestPathLength) << "%" << std::endl;
+        std::cout << "Moves: " << player.getActionCount() << std::endl;
+        // Format the time on its own stream so std::cout keeps its flags
+        std::ostringstream timeText;
+        timeText << std::fixed << std::setprecision(3) << timeTakenMs / 1000.0;
+        std::cout << "Time: " << timeText.str() << " seconds" << std::endl;
+        std::cout << (collectMode ? "Optimal Route: " : "Shortest Path: ")
+                  << shortestPathLength << " moves" << std::endl;
+        std::cout << "Efficiency: " << gameManager.calculateEfficiency(player.getActionCount(), shortestPathLength) << "%" << std::endl;
         std::cout << "Score: " << finalScore << std::endl;
         
-        // Ask for player name
-        std::string playerName;
-        std::cout << std::endl << "Enter your name for the leaderboard: ";
-        std::cin.ignore();
-        std::getline(std::cin, playerName);
+        std::cout << std::endl;
+        telemetry.writeSummary(std::cout);
+        
+        // Only Classic runs can be re-simulated from a replay, so only
+        // they are submitted to the leaderboard
+        bool classicMode = !dynamicWalls && !chaseMode && !collectMode;
         
-        if (!playerName.empty()) {
-            gameManager.addScore(playerName, finalScore);
+        if (classicMode) {
+            // Ask for player name
+            std::string playerName;
+            std::cout << std::endl << "Enter your name for the leaderboard: ";
+            std::getline(std::cin, playerName);
+            
+            if (!playerName.empty()) {
+                ReplayRecord replay;
+                replay.playerName = playerName;
+                replay.seed = maze.getSeed();
+                replay.size = size;
+                replay.timeTakenMs = timeTakenMs;
+                replay.claimedScore = finalScore;
+                replay.moves = player.getSessionString();
+                
+                if (gameManager.addScore(playerName, replay)) {
+                    std::cout << "Leaderboard rank: #" << gameManager.getPlayerRank(playerName)
+                              << " of " << gameManager.getPlayerCount() << std::endl;
+                } else {
+                    Utilities::setColor("red");
+                    std::cout << "Replay verification failed - score not recorded." << std::endl;
+                    Utilities::resetColor();
+                }
+            }
+        } else {
+            std::cout << std::endl << "Leaderboard scores are verified from replays, "
+                      << "which only Classic mode supports." << std::endl;
         }
         
         std::cout << std::endl << "Press Enter to continue...";
         std::cin.get();
     }
+    
+    gameManager.saveTelemetry();
 }
 
 /**
@@ -313,10 +730,10 @@ void watchAISolve() {
     
     // Ask for maze size
     int size = 21;
-    std::cout << "Enter maze size (15, 21, or 25): ";
+    std::cout << "Enter maze size (15-4001): ";
     std::cin >> size;
     if (size < 15) size = 15;
-    if (size > 25) size = 25;
+    if (size > 4001) size = 4001;
     
     // Ask for algorithm
     std::cout << "Choose algorithm (1=BFS, 2=Dijkstra): ";
@@ -332,61 +749,190 @@ void watchAISolve() {
     int exitX = maze.getWidth() - 2;
     int exitY = maze.getHeight() - 2;
     
-    // Find path using chosen algorithm
+    // Start a resumable search using chosen algorithm
     AIPathfinder pathfinder;
-    std::vector<std::pair<int, int>> path;
+    PathSearch search = (algoChoice == 2)
+        ? pathfinder.beginSearchDijkstra(startX, startY, exitX, exitY, maze)
+        : pathfinder.beginSearchBFS(startX, startY, exitX, exitY, maze);
     
-    if (algoChoice == 2) {
-        path = pathfinder.findPathDijkstra(startX, startY, exitX, exitY, maze);
-    } else {
-        path = pathfinder.findPathBFS(startX, startY, exitX, exitY, maze);
+    std::cout << "Press Enter to watch the search...";
+    std::cin.ignore();
+    std::cin.get();
+    
+    // Create a dummy player for display
+    Player dummyPlayer;
+    dummyPlayer.initialize(startX, startY);
+    
+    // Both animations draw into a per-cell trail layer: each step marks its
+    // cells once, and each frame only composes the visible window
+    const int FRAME_MS = 30;                // Fastest frame rate (~33 fps)
+    const int STEP_MS = 200;                // Slowest pace, for short paths
+    const int ANIMATION_MAX_MS = 10000;     // Each animation fits in this
+    std::vector<char> trail((size_t)maze.getWidth() * maze.getHeight(), 0);
+    
+    Telemetry telemetry;
+    FrameRenderer renderer;
+    Viewport view(4);
+    
+    // Animate the search frontier, advancing the search one slice per frame
+    // Node budget sets the pace, time budget keeps every frame responsive
+    AnimationScheduler searchPace((long long)maze.getWidth() * maze.getHeight(),
+                                  ANIMATION_MAX_MS, FRAME_MS, FRAME_MS);
+    const auto SEARCH_BUDGET = std::chrono::milliseconds(FRAME_MS / 2);
+    const int nodesPerFrame = (int)searchPace.getStepsPerFrame();
+    int focusX = startX, focusY = startY;
+    
+    // Solve time is the search work alone, summed over its slices
+    int64_t solveNs = 0;
+    
+    while (!search.isFinished()) {
+        searchPace.waitForFrame();
+        
+        int64_t sliceStart = Telemetry::now();
+        search.stepFor(SEARCH_BUDGET, nodesPerFrame);
+        solveNs += Telemetry::now() - sliceStart;
+        for (const auto& cell : search.getNewlyExplored()) {
+            trail[(size_t)cell.second * maze.getWidth() + cell.first] = '.';
+            focusX = cell.first;
+            focusY = cell.second;
+        }
+        
+        int64_t frameStart = Telemetry::now();
+        displayTrail(renderer, view, maze, dummyPlayer, focusX, focusY, trail);
+        
+        renderer.status() << std::endl << FrameRenderer::colorCode(FrameRenderer::Color::MAGENTA)
+                          << "Searching... explored " << search.getExploredCount() << " cells"
+                          << FrameRenderer::colorCode(FrameRenderer::Color::DEFAULT) << std::endl;
+        renderer.present();
+        telemetry.recordSince(Telemetry::Metric::FRAME_TIME, frameStart);
     }
+    telemetry.record(Telemetry::Metric::SOLVE_TIME, solveNs);
+    
+    std::vector<std::pair<int, int>> path = search.getPath();
     
     if (path.empty()) {
         std::cout << "No path found!" << std::endl;
         std::cout << "Press Enter to continue...";
-        std::cin.ignore();
         std::cin.get();
         return;
     }
     
     // Animate example run
-    std::cout << "Running Example Path..." << std::endl;
-    std::cout << "Path length: " << pathfinder.getPathLength(path) << " moves" << std::endl;
-    std::cout << "Press Enter to start animation...";
-    std::cin.ignore();
+    // The prompt is part of the frame, so it stays inside the rows the
+    // viewport leaves free instead of scrolling the maze
+    displayTrail(renderer, view, maze, dummyPlayer, focusX, focusY, trail);
+    renderer.status() << std::endl << FrameRenderer::colorCode(FrameRenderer::Color::GREEN)
+                      << "Path length: " << pathfinder.getPathLength(path) << " moves. "
+                      << FrameRenderer::colorCode(FrameRenderer::Color::DEFAULT)
+                      << "Press Enter to start the example run...";
+    renderer.present();
     std::cin.get();
     
-    // Create a dummy player for display
-    Player dummyPlayer;
-    dummyPlayer.initialize(startX, startY);
+    // The echoed Enter moved the cursor past the frame: redraw it whole
+    renderer.invalidate();
     
-    // Animate path
-    for (int i = 0; i < (int)path.size(); i++) {
-        Utilities::clearScreen();
+    // Animate path: only the cells added since the last frame are marked,
+    // long paths advance several steps per frame
+    std::fill(trail.begin(), trail.end(), 0);
+    AnimationScheduler pathPace((long long)path.size(), ANIMATION_MAX_MS, FRAME_MS, STEP_MS);
+    long long first, last;
+    
+    while (pathPace.nextFrame(first, last)) {
+        pathPace.waitForFrame();
+        int64_t frameStart = Telemetry::now();
+        
+        for (long long i = first; i < last; i++) {
+            trail[(size_t)path[i].second * maze.getWidth() + path[i].first] = '*';
+        }
         
         // Update dummy player position
-        dummyPlayer.initialize(path[i].first, path[i].second);
+        dummyPlayer.initialize(path[last - 1].first, path[last - 1].second);
         
         // Display maze with example path
-        displayMaze(maze, dummyPlayer, path, i);
+        displayTrail(renderer, view, maze, dummyPlayer, dummyPlayer.getX(), dummyPlayer.getY(), trail);
         
-        std::cout << std::endl;
-        Utilities::setColor("yellow");
-        std::cout << "Step: " << (i + 1) << " / " << path.size() << std::endl;
-        Utilities::resetColor();
-        
-        Utilities::sleep(200);  // Animation speed
+        renderer.status() << std::endl << FrameRenderer::colorCode(FrameRenderer::Color::YELLOW)
+                          << "Step: " << last << " / " << path.size()
+                          << FrameRenderer::colorCode(FrameRenderer::Color::DEFAULT) << std::endl;
+        renderer.present();
+        telemetry.recordSince(Telemetry::Metric::FRAME_TIME, frameStart);
     }
     
-    Utilities::clearScreen();
-    displayMaze(maze, dummyPlayer, path, path.size() - 1);
     std::cout << std::endl;
     Utilities::setColor("green");
     std::cout << "Example path completed in " << path.size() << " moves!" << std::endl;
     Utilities::resetColor();
     
-    std::cout << "Press Enter to continue...";
+    std::cout << std::endl;
+    telemetry.writeSummary(std::cout);
+    
+    std::cout << std::endl << "Press Enter to continue...";
+    std::cin.get();
+}
+
+/**
+ * Crowd simulation - thousands of random walkers stepped together
+ * Uses AgentBatch (structure of arrays) and optionally several threads
+ */
+void runCrowdSimulation() {
+    Utilities::clearScreen();
+    
+    int size = 101;
+    std::cout << "Enter maze size (15-4001): ";
+    std::cin >> size;
+    if (size < 15) size = 15;
+    if (size > 4001) size = 4001;
+    
+    long long walkers = 100000;
+    std::cout << "Number of walkers: ";
+    std::cin >> walkers;
+    if (walkers < 1) walkers = 1;
+    if (walkers > 100000000) walkers = 100000000;
+    
+    int steps = 1000;
+    std::cout << "Number of steps: ";
+    std::cin >> steps;
+    if (steps < 1) steps = 1;
+    
+    int threads = std::max(1u, std::thread::hardware_concurrency());
+    std::cout << "Threads (1-" << threads << "): ";
+    std::cin >> threads;
+    if (threads < 1) threads = 1;
+    
+    MazeGenerator maze(size, size);
+    maze.generateMaze();
+    std::pair<int, int> start = maze.getStartPosition();
+    
+    AgentBatch crowd(maze, (size_t)walkers, start.first, start.second);
+    
+    std::cout << std::endl << "Simulating..." << std::endl;
+    auto begin = std::chrono::steady_clock::now();
+    for (int s = 0; s < steps; s++) {
+        crowd.stepRandom((uint32_t)s * 0x85EBCA6Bu + 1, threads);
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    
+    long long totalMoves = 0;
+    for (size_t i = 0; i < crowd.size(); i++) {
+        totalMoves += crowd.getMoves(i);
+    }
+    
+    std::ios::fmtflags flags = std::cout.flags();
+    std::streamsize precision = std::cout.precision();
+    
+    Utilities::setColor("cyan");
+    std::cout << "Walkers: " << walkers << " | Steps: " << steps << " | Threads: " << threads << std::endl;
+    std::cout << "Reached exit: " << crowd.countReachedGoal() << std::endl;
+    std::cout << "Average successful moves: " << std::fixed << std::setprecision(1)
+              << (double)totalMoves / walkers << std::endl;
+    std::cout << "Throughput: " << std::setprecision(1)
+              << (double)walkers * steps / seconds / 1e6 << " million agent-steps/s" << std::endl;
+    std::cout.flags(flags);
+    std::cout.precision(precision);
+    Utilities::resetColor();
+    
+    std::cout << std::endl << "Press Enter to return to menu...";
+    std::cin.ignore();
     std::cin.get();
 }
 
@@ -429,7 +975,12 @@ void viewHighScores() {
 /**
  * Main function
  */
-int main() {
+int main(int argc, char* argv[]) {
+    // Headless commands bypass the interactive menu
+    if (argc > 1 && CommandLine::isCommand(argv[1])) {
+        return CommandLine::main(argc, argv);
+    }
+    
     bool running = true;
     
     while (running) {
@@ -452,6 +1003,9 @@ int main() {
                 displayInstructions();
                 break;
             case 5:
+                runCrowdSimulation();
+                break;
+            case 6:
                 running = false;
                 std::cout << "Thanks for playing!" << std::endl;
                 break;